@@ -7,6 +7,7 @@ touch src_files.txt
 for example in ${examples[*]}; do
 	find .\/examples\/$example\/src\/ -type f -follow -print | grep "[.]h$\|[.]hpp$\|[.]hxx$\|[.]cpp$" >> src_files.txt
 done
+find .\/examples\/common\/src\/ -type f -follow -print | grep "[.]h$\|[.]hpp$\|[.]hxx$\|[.]cpp$" >> src_files.txt
 
 cppcheck --version
 mkdir cppcheck
@@ -77,7 +77,8 @@ cd ../../examples
 for example in ${EXAMPLES[*]}; do
 	cd $example
 	mkdir cmake && mkdir cmake/Modules
-	if [[ $example == systemc ]]; then
+	# the driver is linked with the SystemC build of AFF3CT when it is available (the 'SYSTEMC' engine)
+	if [[ $example == systemc || ( $example == driver && $is_systemc == YES ) ]]; then
 		cp ../../lib/aff3ct/${BUILD}_systemc/lib/cmake/aff3ct-$AFF3CT_GIT_VERSION/* cmake/Modules
 		cp $SYSTEMC_HOME/FindSystemC.cmake cmake/Modules/
 		cp $SYSTEMC_HOME/FindTLM.cmake cmake/Modules/
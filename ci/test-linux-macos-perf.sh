@@ -0,0 +1,12 @@
+#!/bin/bash
+set -x
+
+if [[ $# < 1 ]]; then exit 1; fi
+
+build=$1
+
+cd examples/bench
+
+# the results of this run are kept (artifact): they become the new baseline when they are committed in 'baseline/'
+./$build/bin/perf_test --baseline baseline/$build.json --save perf_$build.json
+rc=$?; if [[ $rc != 0 ]]; then exit $rc; fi
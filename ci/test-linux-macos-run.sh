@@ -3,6 +3,12 @@ set -x
 
 if [[ $# < 3 ]]; then exit 1; fi
 
+# binary of the example to run ('my_project' by default)
+if [ -z "$BIN" ]
+then
+	BIN="my_project"
+fi
+
 cd examples
 
 i=1
@@ -17,7 +23,7 @@ do
 		params=$arg
 	else
 		build=$arg
-		./$build/bin/my_project $params
+		./$build/bin/$BIN $params
 		rc=$?; if [[ $rc != 0 ]]; then exit $rc; fi
 	fi
 
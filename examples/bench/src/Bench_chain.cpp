@@ -0,0 +1,112 @@
+#include "Bench_chain.hpp"
+
+using namespace aff3ct;
+
+Bench_chain
+::Bench_chain(const int K, const int N, const int n_frames, const int seed, const float ebn0)
+: K(K), N(N), n_frames(n_frames)
+{
+	using namespace module;
+	source  = std::unique_ptr<Source_random         <>>(new Source_random         <>(K, seed, n_frames));
+	encoder = std::unique_ptr<Encoder_repetition_sys<>>(new Encoder_repetition_sys<>(K, N, true, n_frames));
+	modem   = std::unique_ptr<Modem_BPSK            <>>(new Modem_BPSK            <>(N, tools::Sigma<>(), false,
+	                                                                                   n_frames));
+	channel = std::unique_ptr<Channel_AWGN_LLR      <>>(new Channel_AWGN_LLR      <>(N, seed +1, false,
+	                                                                                   tools::Sigma<>(), n_frames));
+	decoder = std::unique_ptr<Decoder_repetition_std<>>(new Decoder_repetition_std<>(K, N, true, n_frames));
+	monitor = std::unique_ptr<Monitor_BFER          <>>(new Monitor_BFER          <>(K, 100, 0, false, n_frames));
+	noise   = std::unique_ptr<tools::Sigma          <>>(new tools::Sigma          <>());
+	list    = { source.get(), encoder.get(), modem.get(), channel.get(), decoder.get(), monitor.get() };
+
+	for (auto& mod : list)
+		for (auto& tsk : mod->tasks)
+		{
+			tsk->set_autoalloc  (true ); // enable the automatic allocation of the data in the tasks
+			tsk->set_autoexec   (false); // disable the auto execution mode of the tasks
+			tsk->set_debug      (false); // disable the debug mode
+		}
+	this->set_fast(true);
+
+	// sockets binding (connect the sockets of the tasks = fill the input sockets with the output sockets)
+	(*encoder)[enc::sck::encode      ::U_K ].bind((*source )[src::sck::generate   ::U_K ]);
+	(*modem  )[mdm::sck::modulate    ::X_N1].bind((*encoder)[enc::sck::encode     ::X_N ]);
+	(*channel)[chn::sck::add_noise   ::X_N ].bind((*modem  )[mdm::sck::modulate   ::X_N2]);
+	(*modem  )[mdm::sck::demodulate  ::Y_N1].bind((*channel)[chn::sck::add_noise  ::Y_N ]);
+	(*decoder)[dec::sck::decode_siho ::Y_N ].bind((*modem  )[mdm::sck::demodulate ::Y_N2]);
+	(*monitor)[mnt::sck::check_errors::U   ].bind((*encoder)[enc::sck::encode     ::U_K ]);
+	(*monitor)[mnt::sck::check_errors::V   ].bind((*decoder)[dec::sck::decode_siho::V_K ]);
+
+	const std::vector<std::pair<std::string,Task*>> chain =
+	{
+		{ "source::generate",      &(*source )[src::tsk::generate    ] },
+		{ "encoder::encode",       &(*encoder)[enc::tsk::encode      ] },
+		{ "modem::modulate",       &(*modem  )[mdm::tsk::modulate    ] },
+		{ "channel::add_noise",    &(*channel)[chn::tsk::add_noise   ] },
+		{ "modem::demodulate",     &(*modem  )[mdm::tsk::demodulate  ] },
+		{ "decoder::decode_siho",  &(*decoder)[dec::tsk::decode_siho ] },
+		{ "monitor::check_errors", &(*monitor)[mnt::tsk::check_errors] },
+	};
+	for (auto &t : chain)
+	{
+		size_t bytes = 0;
+		for (auto &s : t.second->sockets)
+			bytes += s->get_databytes();
+		this->tasks.push_back({ t.first, t.second, bytes / (size_t)n_frames });
+	}
+
+	// the sigma of the SNR point
+	const auto R     = (float)K / (float)N;
+	const auto esn0  = tools::ebn0_to_esn0 (ebn0, R);
+	const auto sigma = tools::esn0_to_sigma(esn0   );
+	noise->set_noise(sigma, ebn0, esn0);
+	modem  ->set_noise(*noise);
+	channel->set_noise(*noise);
+}
+
+void Bench_chain
+::set_fast(const bool fast)
+{
+	for (auto& mod : this->list)
+		for (auto& tsk : mod->tasks)
+		{
+			tsk->set_stats(!fast);
+			tsk->set_fast ( fast);
+		}
+}
+
+void Bench_chain
+::exec()
+{
+	for (auto &t : this->tasks)
+		t.ptr->exec();
+}
+
+const std::vector<Bench_chain::task>& Bench_chain
+::get_tasks() const
+{
+	return this->tasks;
+}
+
+const std::vector<const module::Module*>& Bench_chain
+::get_modules() const
+{
+	return this->list;
+}
+
+int Bench_chain
+::get_K() const
+{
+	return this->K;
+}
+
+int Bench_chain
+::get_N() const
+{
+	return this->N;
+}
+
+int Bench_chain
+::get_n_frames() const
+{
+	return this->n_frames;
+}
@@ -0,0 +1,55 @@
+#ifndef BENCH_CHAIN_HPP_
+#define BENCH_CHAIN_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+
+// the chain of the 'bootstrap' example (repetition code, BPSK, AWGN) with 'n_frames' frames per task, its tasks can be
+// executed alone on the buffers of the previous execution of the chain
+class Bench_chain
+{
+public:
+	struct task
+	{
+		std::string            name;  // "module::task"
+		aff3ct::module::Task  *ptr;
+		size_t                 bytes; // sum of the sizes of the sockets of the task for one frame
+	};
+
+protected:
+	const int K;
+	const int N;
+	const int n_frames;
+
+	std::unique_ptr<aff3ct::module::Source_random<>>          source;
+	std::unique_ptr<aff3ct::module::Encoder_repetition_sys<>> encoder;
+	std::unique_ptr<aff3ct::module::Modem_BPSK<>>             modem;
+	std::unique_ptr<aff3ct::module::Channel_AWGN_LLR<>>       channel;
+	std::unique_ptr<aff3ct::module::Decoder_repetition_std<>> decoder;
+	std::unique_ptr<aff3ct::module::Monitor_BFER<>>           monitor;
+	std::unique_ptr<aff3ct::tools::Sigma<>>                   noise;
+	std::vector<const aff3ct::module::Module*>                list;
+	std::vector<task>                                         tasks; // in the order of the chain
+
+public:
+	Bench_chain(const int K, const int N, const int n_frames, const int seed, const float ebn0);
+	virtual ~Bench_chain() = default;
+
+	// fast mode: no check of the sockets and no statistics, stats mode: the tasks measure their durations
+	void set_fast(const bool fast);
+
+	// execute all the tasks once
+	void exec();
+
+	const std::vector<task>&                          get_tasks  () const;
+	const std::vector<const aff3ct::module::Module*>& get_modules() const;
+	int get_K       () const;
+	int get_N       () const;
+	int get_n_frames() const;
+};
+
+#endif /* BENCH_CHAIN_HPP_ */
@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cctype>
+#include <cmath>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Perf_baseline.hpp"
+
+using namespace aff3ct;
+
+Perf_result Perf_result
+::make(const std::string &name, const std::string &metric, const bool higher_is_better,
+       const std::vector<double> &samples)
+{
+	double mean = 0.;
+	for (auto s : samples) mean += s;
+	mean /= (double)std::max((size_t)1, samples.size());
+
+	double var = 0.;
+	for (auto s : samples) var += (s - mean) * (s - mean);
+	var /= (double)std::max((size_t)1, samples.size() -1);
+
+	return { name, metric, higher_is_better, mean, std::sqrt(var), (int)samples.size() };
+}
+
+// the objects of the "results" array are flat (strings, numbers and booleans), the file is written by 'save'
+std::vector<Perf_result> Perf_baseline
+::load(const std::string &path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "The baseline file cannot be opened ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	const auto json = ss.str();
+
+	auto fail = [&path](const std::string &what)
+	{
+		std::stringstream message;
+		message << "The baseline file is not valid (" << what << ", 'path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	};
+
+	auto pos = json.find("\"results\"");
+	if (pos == std::string::npos) fail("no 'results'");
+	pos = json.find('[', pos);
+	if (pos == std::string::npos) fail("'results' is not an array");
+
+	auto skip_ws = [&json](size_t p) { while (p < json.size() && std::isspace((unsigned char)json[p])) p++; return p; };
+	auto read_string = [&json, &fail](size_t &p) -> std::string
+	{
+		if (json[p] != '"') fail("string expected");
+		const auto end = json.find('"', p +1);
+		if (end == std::string::npos) fail("unterminated string");
+		const auto str = json.substr(p +1, end - p -1);
+		p = end +1;
+		return str;
+	};
+
+	std::vector<Perf_result> results;
+	pos = skip_ws(pos +1);
+	while (pos < json.size() && json[pos] != ']')
+	{
+		if (json[pos] != '{') fail("object expected");
+		pos = skip_ws(pos +1);
+
+		std::map<std::string,std::string> fields;
+		while (pos < json.size() && json[pos] != '}')
+		{
+			const auto key = read_string(pos);
+			pos = skip_ws(pos);
+			if (json[pos] != ':') fail("':' expected");
+			pos = skip_ws(pos +1);
+
+			std::string value;
+			if (json[pos] == '"')
+				value = read_string(pos);
+			else
+			{
+				const auto end = json.find_first_of(",}", pos);
+				if (end == std::string::npos) fail("unterminated value");
+				value = json.substr(pos, end - pos);
+				value.erase(value.find_last_not_of(" \t\r\n") +1);
+				pos = end;
+			}
+			fields[key] = value;
+
+			pos = skip_ws(pos);
+			if (json[pos] == ',') pos = skip_ws(pos +1);
+		}
+		if (pos >= json.size()) fail("unterminated object");
+		pos = skip_ws(pos +1);
+		if (json[pos] == ',') pos = skip_ws(pos +1);
+
+		for (auto &k : { "name", "metric", "higher_is_better", "mean", "stddev", "n" })
+			if (!fields.count(k)) fail(std::string("no '") + k + "' in a result");
+
+		results.push_back({ fields["name"], fields["metric"], fields["higher_is_better"] == "true",
+		                    std::strtod(fields["mean"  ].c_str(), nullptr),
+		                    std::strtod(fields["stddev"].c_str(), nullptr),
+		                    std::atoi  (fields["n"     ].c_str()) });
+	}
+	if (pos >= json.size()) fail("unterminated 'results'");
+
+	return results;
+}
+
+void Perf_baseline
+::save(const std::string &path, const std::vector<Perf_result> &results)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "The baseline file cannot be written ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << "{" << std::endl;
+	file << "  \"version\": 1," << std::endl;
+	file << "  \"results\": [" << std::endl;
+	file << std::setprecision(9);
+	for (size_t r = 0; r < results.size(); r++)
+	{
+		const auto &res = results[r];
+		file << "    { \"name\": \"" << res.name << "\", \"metric\": \"" << res.metric << "\", "
+		     << "\"higher_is_better\": " << (res.higher_is_better ? "true" : "false") << ", "
+		     << "\"mean\": " << res.mean << ", \"stddev\": " << res.stddev << ", \"n\": " << res.n << " }"
+		     << (r +1 < results.size() ? "," : "") << std::endl;
+	}
+	file << "  ]" << std::endl;
+	file << "}" << std::endl;
+}
+
+bool Perf_baseline
+::compare(const std::vector<Perf_result> &baseline, const std::vector<Perf_result> &current, const double tolerance,
+          const double k, std::ostream &stream)
+{
+	if (baseline.empty())
+	{
+		stream << "# The baseline is empty: record it on this machine with '--save' and commit it." << std::endl;
+		return false;
+	}
+
+	std::map<std::string,const Perf_result*> base;
+	for (auto &b : baseline)
+		base[b.name + "/" + b.metric] = &b;
+
+	const std::string sep = "# -----------------------|------------------------------|--------------------------|"
+	                        "--------------------------|---------|--------|-----------";
+	stream << sep << std::endl;
+	stream << "#                  CHAIN |                       METRIC |      BASELINE (MEAN+-SD) |"
+	          "       CURRENT (MEAN+-SD) | CHANGE  |    Z   | STATUS" << std::endl;
+	stream << sep << std::endl;
+
+	auto fmt = [](const double mean, const double sd) -> std::string
+	{
+		std::stringstream s;
+		s << std::setprecision(4) << std::setw(11) << mean << " +- " << std::left << std::setw(9) << sd;
+		return s.str();
+	};
+
+	bool ok = true;
+	std::map<std::string,bool> measured;
+	for (auto &c : current)
+	{
+		auto it = base.find(c.name + "/" + c.metric);
+		measured[c.name + "/" + c.metric] = true;
+		stream << "# " << std::setw(22) << c.name << " | " << std::setw(28) << c.metric << " | ";
+
+		if (it == base.end())
+		{
+			stream << std::setw(24) << "-" << " | " << fmt(c.mean, c.stddev) << " |       - |      - | NEW"
+			       << std::endl;
+			continue;
+		}
+
+		const auto &b = *it->second;
+		const auto change = b.mean != 0. ? (c.mean - b.mean) / b.mean : 0.;
+		const auto se     = std::sqrt(b.stddev * b.stddev / (double)std::max(1, b.n) +
+		                              c.stddev * c.stddev / (double)std::max(1, c.n));
+		const auto z      = se > 0. ? (c.mean - b.mean) / se : (c.mean != b.mean ? HUGE_VAL : 0.);
+
+		// positive = worse
+		const auto worse  = c.higher_is_better ? -change : change;
+		const auto z_bad  = c.higher_is_better ? -z      : z;
+
+		std::string status = "OK";
+		if (worse > tolerance && z_bad > k)
+		{
+			status = "REGRESSION";
+			ok = false;
+		}
+		else if (-worse > tolerance && -z_bad > k)
+			status = "IMPROVED";
+
+		stream << fmt(b.mean, b.stddev) << " | " << fmt(c.mean, c.stddev) << " | "
+		       << std::fixed << std::setprecision(1) << std::showpos << std::setw(6) << 100. * change << "% | "
+		       << std::setw(6) << std::min(std::max(z, -999.), 999.) << std::noshowpos << " | " << status
+		       << std::endl;
+		stream.unsetf(std::ios::floatfield);
+	}
+
+	// a metric of the baseline that is not measured any more cannot be checked
+	for (auto &b : baseline)
+		if (!measured.count(b.name + "/" + b.metric))
+		{
+			stream << "# " << std::setw(22) << b.name << " | " << std::setw(28) << b.metric << " | "
+			       << fmt(b.mean, b.stddev) << " | " << std::setw(24) << "-" << " |       - |      - | MISSING"
+			       << std::endl;
+			ok = false;
+		}
+	stream << sep << std::endl;
+
+	return ok;
+}
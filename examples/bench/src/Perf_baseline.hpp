@@ -0,0 +1,39 @@
+#ifndef PERF_BASELINE_HPP_
+#define PERF_BASELINE_HPP_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// performance results of a run (mean and standard deviation over the repetitions) and their comparison with the
+// results of a reference run, stored in a JSON file:
+// { "version": 1, "results": [ { "name": "...", "metric": "...", "higher_is_better": true, "mean": 1.0,
+//                                "stddev": 0.1, "n": 5 }, ... ] }
+struct Perf_result
+{
+	std::string name;             // configuration of the chain
+	std::string metric;           // "chain_mbps" or "<module>::<task>_ns"
+	bool        higher_is_better;
+	double      mean;
+	double      stddev;
+	int         n;                // number of repetitions
+
+	static Perf_result make(const std::string &name, const std::string &metric, const bool higher_is_better,
+	                        const std::vector<double> &samples);
+};
+
+class Perf_baseline
+{
+public:
+	static std::vector<Perf_result> load(const std::string &path);
+	static void                     save(const std::string &path, const std::vector<Perf_result> &results);
+
+	// display the differences between the baseline and the current results, return false if a metric is
+	// significantly worse: the relative change is larger than 'tolerance' and than 'k' standard errors of the
+	// difference of the means (Welch). An empty baseline or a metric of the baseline that is not in the current
+	// results also fails (the check would not compare anything)
+	static bool compare(const std::vector<Perf_result> &baseline, const std::vector<Perf_result> &current,
+	                    const double tolerance, const double k, std::ostream &stream = std::cout);
+};
+
+#endif /* PERF_BASELINE_HPP_ */
@@ -0,0 +1,198 @@
+#include <functional>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+using namespace aff3ct;
+
+#include "Bench_chain.hpp"
+
+struct params
+{
+	int                 N_min    =      32;       // smallest frame size
+	int                 N_max    = 1 << 20;       // largest frame size (the sizes are the powers of 2 in between)
+	int                 rep      =       4;       // repetition factor (K = N / rep)
+	std::vector<int>    frames   = { 1, 8, 64 };  // numbers of frames per task call
+	uint64_t            budget   = 1ull << 26;    // number of symbols processed per measure (N x frames x calls)
+	uint64_t            max_elmt = 1ull << 23;    // largest socket (N x frames), the larger combinations are skipped
+	int                 seed     =       0;       // PRNG seed
+	float               ebn0     =   4.00f;       // SNR of the frames
+	std::string         csv      =      "";       // CSV output file (empty = no CSV)
+};
+void init_params(int argc, char** argv, params &p);
+
+// time per call of 'run' (in ns), 'n_runs' calls after a warmup call
+double time_ns(const uint64_t n_runs, const std::function<void()> &run);
+
+int main(int argc, char** argv)
+{
+	// get the AFF3CT version
+	const std::string v = "v" + std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "# This is a basic program using the AFF3CT library (" << v << ")" << std::endl;
+	std::cout << "# Feel free to improve it as you want to fit your needs."         << std::endl;
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "#"                                                                << std::endl;
+
+	params p; init_params(argc, argv, p);
+
+	std::ofstream csv;
+	if (!p.csv.empty())
+	{
+		csv.open(p.csv);
+		if (!csv.is_open())
+		{
+			std::cerr << "# The CSV file cannot be opened ('p.csv' = " << p.csv << ")." << std::endl;
+			return EXIT_FAILURE;
+		}
+		csv << "N,K,n_frames,task,bytes_per_frame,fast_ns_per_frame,fast_gbps,stats_ns_per_frame,stats_gbps,"
+		    << "stats_overhead_pct" << std::endl;
+	}
+
+	const std::string sep = "# --------|------|-----------------------|-----------|----------------------|"
+	                        "----------------------|---------";
+	std::cout << sep << std::endl;
+	std::cout << "#       N |    F |                  TASK |     BYTES |       FAST MODE      |"
+	             "      STATS MODE      | OVERHD. " << std::endl;
+	std::cout << "#         |      |                       | (B/frame) | (ns/frame) |  (Gb/s) |"
+	             " (ns/frame) |  (Gb/s) |     (%) " << std::endl;
+	std::cout << sep << std::endl;
+
+	for (auto N = p.N_min; N <= p.N_max; N *= 2)
+		for (auto F : p.frames)
+		{
+			if ((uint64_t)N * (uint64_t)F > p.max_elmt)
+				continue;
+
+			const auto K = N / p.rep;
+			Bench_chain chain(K, N, F, p.seed, p.ebn0);
+			const auto n_runs = std::max((uint64_t)4, p.budget / ((uint64_t)N * (uint64_t)F));
+
+			// each task runs alone on the buffers of the previous execution of the chain, then the whole chain
+			std::vector<std::pair<std::string,std::function<void()>>> runs;
+			for (auto &t : chain.get_tasks())
+			{
+				auto task = t.ptr;
+				runs.push_back(std::make_pair(t.name, [task]() { task->exec(); }));
+			}
+			runs.push_back(std::make_pair(std::string("chain"), [&chain]() { chain.exec(); }));
+
+			chain.exec();
+			for (size_t r = 0; r < runs.size(); r++)
+			{
+				size_t bytes = 0;
+				if (r < chain.get_tasks().size())
+					bytes = chain.get_tasks()[r].bytes;
+				else
+					for (auto &t : chain.get_tasks())
+						bytes += t.bytes;
+
+				chain.set_fast(true );
+				const auto t_fast  = time_ns(n_runs, runs[r].second) / (double)F;
+				chain.set_fast(false);
+				const auto t_stats = time_ns(n_runs, runs[r].second) / (double)F;
+
+				// information throughput (K bits per frame)
+				const auto thr_fast  = (double)K / t_fast;
+				const auto thr_stats = (double)K / t_stats;
+				const auto overhead  = 100. * (t_stats - t_fast) / t_fast;
+
+				std::cout << "# " << std::setw(7) << N << " | " << std::setw(4) << F << " | "
+				          << std::setw(21) << runs[r].first << " | " << std::setw(9) << bytes << " | "
+				          << std::fixed << std::setprecision(1)
+				          << std::setw(10) << t_fast  << " | " << std::setprecision(3) << std::setw(7) << thr_fast
+				          << " | " << std::setprecision(1)
+				          << std::setw(10) << t_stats << " | " << std::setprecision(3) << std::setw(7) << thr_stats
+				          << " | " << std::setprecision(1) << std::setw(7) << overhead << std::endl;
+				std::cout.unsetf(std::ios::floatfield);
+
+				if (csv.is_open())
+					csv << N << "," << K << "," << F << "," << runs[r].first << "," << bytes << ","
+					    << t_fast << "," << thr_fast << "," << t_stats << "," << thr_stats << "," << overhead
+					    << std::endl;
+			}
+			std::cout << sep << std::endl;
+		}
+
+	std::cout << "# End of the benchmark" << std::endl;
+
+	return 0;
+}
+
+void init_params(int argc, char** argv, params &p)
+{
+	auto usage = [argv]()
+	{
+		std::cerr << "usage: " << argv[0] << " [--n-min N] [--n-max N] [--rep R] [--frames F1,F2,...] "
+		          << "[--budget SYMBOLS] [--max-elmt SYMBOLS] [--seed S] [--ebn0 DB] [--csv FILE]" << std::endl;
+		std::exit(EXIT_FAILURE);
+	};
+
+	for (int a = 1; a < argc; a++)
+	{
+		const std::string arg = argv[a];
+		if (a +1 >= argc)
+			usage();
+		const std::string val = argv[++a];
+
+		     if (arg == "--n-min"   ) p.N_min    = std::atoi(val.c_str());
+		else if (arg == "--n-max"   ) p.N_max    = std::atoi(val.c_str());
+		else if (arg == "--rep"     ) p.rep      = std::atoi(val.c_str());
+		else if (arg == "--budget"  ) p.budget   = std::strtoull(val.c_str(), nullptr, 10);
+		else if (arg == "--max-elmt") p.max_elmt = std::strtoull(val.c_str(), nullptr, 10);
+		else if (arg == "--seed"    ) p.seed     = std::atoi(val.c_str());
+		else if (arg == "--ebn0"    ) p.ebn0     = std::strtof(val.c_str(), nullptr);
+		else if (arg == "--csv"     ) p.csv      = val;
+		else if (arg == "--frames"  )
+		{
+			p.frames.clear();
+			std::stringstream ss(val);
+			std::string f;
+			while (std::getline(ss, f, ','))
+				p.frames.push_back(std::atoi(f.c_str()));
+		}
+		else
+			usage();
+	}
+
+	if (p.N_min <= 0 || p.N_max < p.N_min || p.rep <= 0 || p.N_min < p.rep || p.frames.empty())
+		usage();
+	for (auto f : p.frames)
+		if (f <= 0)
+			usage();
+
+	std::cout << "# * Benchmark parameters: "                        << std::endl;
+	std::cout << "#    ** Frame sizes (N) = " << p.N_min << " to " << p.N_max << " (x2)" << std::endl;
+	std::cout << "#    ** Repetitions     = " << p.rep << " (K = N / " << p.rep << ")" << std::endl;
+	std::cout << "#    ** Frames per call = ";
+	for (size_t f = 0; f < p.frames.size(); f++)
+		std::cout << (f ? ", " : "") << p.frames[f];
+	std::cout                                                        << std::endl;
+	std::cout << "#    ** Symbols/measure = " << p.budget            << std::endl;
+	std::cout << "#    ** Max. socket     = " << p.max_elmt          << std::endl;
+	std::cout << "#    ** Seed            = " << p.seed              << std::endl;
+	std::cout << "#    ** SNR        (dB) = " << p.ebn0              << std::endl;
+	std::cout << "#"                                                 << std::endl;
+}
+
+double time_ns(const uint64_t n_runs, const std::function<void()> &run)
+{
+	run(); // warmup
+	const auto t_start = std::chrono::steady_clock::now();
+	for (uint64_t r = 0; r < n_runs; r++)
+		run();
+	const auto t_stop = std::chrono::steady_clock::now();
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() / (double)n_runs;
+}
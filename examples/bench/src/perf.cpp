@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+using namespace aff3ct;
+
+#include "Bench_chain.hpp"
+#include "Perf_baseline.hpp"
+
+struct params
+{
+	uint64_t    budget    = 1ull << 24; // number of symbols per repetition of a chain (N x frames)
+	int         reps      =          5; // number of repetitions of each measure
+	int         seed      =          0; // PRNG seed
+	float       ebn0      =      4.00f; // SNR of the frames
+	double      tolerance =       0.10; // relative change of a metric below which it is never a regression (10%)
+	double      k         =       3.00; // number of standard errors above which a change is significant
+	std::string baseline  =         ""; // JSON file of the reference results (empty = no comparison)
+	std::string save      =         ""; // JSON file of the current results (empty = not saved)
+};
+void init_params(int argc, char** argv, params &p);
+
+// the fixed set of chains of the performance test: repetition code, BPSK, AWGN
+struct config
+{
+	int K;
+	int N;
+	int n_frames;
+};
+const std::vector<config> configs = { { 32, 128, 1 }, { 256, 1024, 8 }, { 1024, 4096, 16 } };
+
+void measure(const params &p, const config &c, std::vector<Perf_result> &results);
+
+int main(int argc, char** argv)
+{
+	// get the AFF3CT version
+	const std::string v = "v" + std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "# This is a basic program using the AFF3CT library (" << v << ")" << std::endl;
+	std::cout << "# Feel free to improve it as you want to fit your needs."         << std::endl;
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "#"                                                                << std::endl;
+
+	params p; init_params(argc, argv, p);
+
+	try
+	{
+		std::vector<Perf_result> results;
+		for (auto &c : configs)
+			measure(p, c, results);
+
+		if (!p.save.empty())
+		{
+			Perf_baseline::save(p.save, results);
+			std::cout << "# Results saved in '" << p.save << "'" << std::endl;
+		}
+
+		if (!p.baseline.empty())
+		{
+			const auto baseline = Perf_baseline::load(p.baseline);
+			std::cout << "# Comparison with the baseline '" << p.baseline << "' (tolerance = "
+			          << 100. * p.tolerance << "%, significance = " << p.k << " standard errors):" << std::endl;
+			if (!Perf_baseline::compare(baseline, results, p.tolerance, p.k))
+			{
+				std::cout << "# FAILED: performance regression" << std::endl;
+				return EXIT_FAILURE;
+			}
+			std::cout << "# PASSED" << std::endl;
+		}
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+void init_params(int argc, char** argv, params &p)
+{
+	auto usage = [argv]()
+	{
+		std::cerr << "usage: " << argv[0] << " [--baseline FILE] [--save FILE] [--budget SYMBOLS] [--reps R] "
+		          << "[--tolerance T] [--k K] [--seed S] [--ebn0 DB]" << std::endl;
+		std::exit(EXIT_FAILURE);
+	};
+
+	for (int a = 1; a < argc; a++)
+	{
+		const std::string arg = argv[a];
+		if (a +1 >= argc)
+			usage();
+		const std::string val = argv[++a];
+
+		     if (arg == "--baseline" ) p.baseline  = val;
+		else if (arg == "--save"     ) p.save      = val;
+		else if (arg == "--budget"   ) p.budget    = std::strtoull(val.c_str(), nullptr, 10);
+		else if (arg == "--reps"     ) p.reps      = std::atoi(val.c_str());
+		else if (arg == "--tolerance") p.tolerance = std::strtod(val.c_str(), nullptr);
+		else if (arg == "--k"        ) p.k         = std::strtod(val.c_str(), nullptr);
+		else if (arg == "--seed"     ) p.seed      = std::atoi(val.c_str());
+		else if (arg == "--ebn0"     ) p.ebn0      = std::strtof(val.c_str(), nullptr);
+		else
+			usage();
+	}
+
+	if (p.reps < 2 || p.budget == 0 || p.tolerance < 0. || p.k < 0.)
+		usage();
+
+	std::cout << "# * Performance test parameters: "                   << std::endl;
+	std::cout << "#    ** Symbols/repetition = " << p.budget           << std::endl;
+	std::cout << "#    ** Repetitions        = " << p.reps             << std::endl;
+	std::cout << "#    ** Seed               = " << p.seed             << std::endl;
+	std::cout << "#    ** SNR           (dB) = " << p.ebn0             << std::endl;
+	std::cout << "#    ** Tolerance      (%) = " << 100. * p.tolerance << std::endl;
+	std::cout << "#    ** Significance       = " << p.k                << std::endl;
+	std::cout << "#    ** Baseline           = " << (p.baseline.empty() ? "-" : p.baseline) << std::endl;
+	std::cout << "#"                                                   << std::endl;
+}
+
+void measure(const params &p, const config &c, std::vector<Perf_result> &results)
+{
+	const auto name = "K" + std::to_string(c.K) + "_N" + std::to_string(c.N) + "_F" + std::to_string(c.n_frames);
+	std::cout << "# Chain " << name << "..." << std::endl;
+
+	Bench_chain chain(c.K, c.N, c.n_frames, p.seed, p.ebn0);
+	const auto &tasks = chain.get_tasks();
+	const auto n_runs = std::max((uint64_t)1, p.budget / ((uint64_t)c.N * (uint64_t)c.n_frames));
+
+	std::vector<double>              thr;                  // chain throughput of each repetition (Mb/s)
+	std::vector<std::vector<double>> t_tasks(tasks.size()); // time of each task per frame of each repetition (ns)
+	chain.exec(); // warmup
+	for (auto r = 0; r < p.reps; r++)
+	{
+		// the throughput is measured in fast mode (the mode of the simulations without statistics)
+		chain.set_fast(true);
+		const auto t_start = std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < n_runs; i++)
+			chain.exec();
+		const auto t_stop = std::chrono::steady_clock::now();
+		const auto sec = std::chrono::duration<double>(t_stop - t_start).count();
+		thr.push_back((double)n_runs * (double)c.n_frames * (double)c.K / sec * 1e-6);
+
+		// the time of the tasks is given by their statistics
+		chain.set_fast(false);
+		std::vector<std::pair<uint64_t,std::chrono::nanoseconds>> before;
+		for (auto &t : tasks)
+			before.push_back(std::make_pair((uint64_t)t.ptr->get_n_calls(), t.ptr->get_duration_total()));
+		for (uint64_t i = 0; i < n_runs; i++)
+			chain.exec();
+		for (size_t t = 0; t < tasks.size(); t++)
+		{
+			const auto n_calls  = (uint64_t)tasks[t].ptr->get_n_calls() - before[t].first;
+			const auto duration = tasks[t].ptr->get_duration_total() - before[t].second;
+			t_tasks[t].push_back((double)duration.count() / ((double)std::max((uint64_t)1, n_calls) *
+			                                                 (double)c.n_frames));
+		}
+	}
+
+	results.push_back(Perf_result::make(name, "chain_mbps", true, thr));
+	for (size_t t = 0; t < tasks.size(); t++)
+		results.push_back(Perf_result::make(name, tasks[t].name + "_ns", false, t_tasks[t]));
+}
@@ -0,0 +1,76 @@
+#include "Factory/Channel/Channel_extended.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+Channel_extended::parameters
+::parameters(const std::string &prefix)
+: Channel::parameters(prefix)
+{
+}
+
+Channel_extended::parameters* Channel_extended::parameters
+::clone() const
+{
+	return new Channel_extended::parameters(*this);
+}
+
+void Channel_extended::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Channel::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+
+	tools::add_options(args.at({p+"-type"}), 0, "AWGN_RING", "RAYLEIGH_FAST");
+
+	args.add(
+		{p+"-ring-producers"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of threads generating the noise in advance (only for the 'AWGN_RING' channel).");
+
+	args.add(
+		{p+"-ring-blocks"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of noise frames generated in advance by each thread (only for the 'AWGN_RING' channel).");
+
+	args.add(
+		{p+"-coherence"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of consecutive symbols with the same gain, 1 is i.i.d. fading (only for the 'RAYLEIGH_FAST' channel).");
+}
+
+void Channel_extended::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Channel::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-ring-producers"})) this->ring_producers = vals.to_int({p+"-ring-producers"});
+	if(vals.exist({p+"-ring-blocks"   })) this->ring_blocks    = vals.to_int({p+"-ring-blocks"   });
+	if(vals.exist({p+"-coherence"     })) this->coherence      = vals.to_int({p+"-coherence"     });
+}
+
+void Channel_extended::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Channel::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->type == "AWGN_RING")
+	{
+		headers[p].push_back(std::make_pair("Noise producers", std::to_string(this->ring_producers)));
+		headers[p].push_back(std::make_pair("Noise blocks",    std::to_string(this->ring_blocks   )));
+	}
+
+	if (this->type == "RAYLEIGH_FAST")
+		headers[p].push_back(std::make_pair("Coherence (symbols)", std::to_string(this->coherence)));
+}
+
+bool Channel_extended::parameters
+::has_gains() const
+{
+	return this->type == "RAYLEIGH" || this->type == "RAYLEIGH_USER" || this->type == "RAYLEIGH_FAST";
+}
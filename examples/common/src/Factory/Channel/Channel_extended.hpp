@@ -0,0 +1,51 @@
+#ifndef FACTORY_CHANNEL_EXTENDED_HPP_
+#define FACTORY_CHANNEL_EXTENDED_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+// the channels of the library + the channels of the examples ('--chn-type')
+struct Channel_extended : Channel
+{
+	class parameters : public Channel::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		int ring_producers = 1;  // number of threads generating the noise ('AWGN_RING')
+		int ring_blocks    = 64; // number of noise blocks (= frames) generated in advance per thread ('AWGN_RING')
+		int coherence      = 1;  // number of consecutive symbols with the same gain ('RAYLEIGH_FAST')
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Channel_prefix);
+		virtual ~parameters() = default;
+		Channel_extended::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// the channel gives its gains: the chain has to use the 'add_noise_wg' and 'demodulate_wg' tasks
+		bool has_gains() const;
+
+		// builder
+		template <typename R = float>
+		module::Channel<R>* build() const;
+	};
+
+	template <typename R = float>
+	static module::Channel<R>* build(const parameters &params);
+};
+}
+}
+
+#include "Factory/Channel/Channel_extended.hxx"
+
+#endif /* FACTORY_CHANNEL_EXTENDED_HPP_ */
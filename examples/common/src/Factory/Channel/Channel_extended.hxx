@@ -0,0 +1,30 @@
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_ring.hpp"
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_fast.hpp"
+#include "Factory/Channel/Channel_extended.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+template <typename R>
+module::Channel<R>* Channel_extended::parameters
+::build() const
+{
+	if (this->type == "AWGN_RING")
+		return new module::Channel_AWGN_LLR_ring<R>(this->N, this->seed, (size_t)this->ring_producers,
+		                                            (size_t)this->ring_blocks, tools::Sigma<R>(), this->n_frames);
+	if (this->type == "RAYLEIGH_FAST")
+		return new module::Channel_Rayleigh_LLR_fast<R>(this->N, this->complex, this->coherence, this->seed,
+		                                                tools::Sigma<R>(), this->n_frames);
+
+	return Channel::parameters::build<R>();
+}
+
+template <typename R>
+module::Channel<R>* Channel_extended
+::build(const parameters &params)
+{
+	return params.template build<R>();
+}
+}
+}
@@ -0,0 +1,81 @@
+#include "Factory/Checkpoint/Checkpoint.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Checkpoint_name   = "Checkpoint";
+const std::string aff3ct::factory::Checkpoint_prefix = "ckp";
+
+Checkpoint::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Checkpoint_name, Checkpoint_name, prefix)
+{
+}
+
+Checkpoint::parameters* Checkpoint::parameters
+::clone() const
+{
+	return new Checkpoint::parameters(*this);
+}
+
+void Checkpoint::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-path"},
+		tools::Text(),
+		"path to the checkpoint file (the state of the simulation is periodically saved in this file).");
+
+	args.add(
+		{p+"-period"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"time between two checkpoints (in seconds).");
+
+	args.add(
+		{p+"-resume", "resume"},
+		tools::None(),
+		"continue the simulation from the checkpoint file (if it exists).");
+}
+
+void Checkpoint::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-path"            })) this->path   = vals.at({p+"-path"});
+	if(vals.exist({p+"-period"          })) this->period = std::chrono::seconds(vals.to_int({p+"-period"}));
+	if(vals.exist({p+"-resume", "resume"})) this->resume = true;
+}
+
+void Checkpoint::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	if (!this->is_enabled())
+		return;
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Path",       this->path                            ));
+	headers[p].push_back(std::make_pair("Period (s)", std::to_string(this->period.count())));
+	headers[p].push_back(std::make_pair("Resume",     this->resume ? "yes" : "no"           ));
+}
+
+bool Checkpoint::parameters
+::is_enabled() const
+{
+	return !this->path.empty();
+}
+
+tools::Checkpointer* Checkpoint::parameters
+::build() const
+{
+	return new tools::Checkpointer(this->path, this->period);
+}
+
+tools::Checkpointer* Checkpoint
+::build(const parameters &params)
+{
+	return params.build();
+}
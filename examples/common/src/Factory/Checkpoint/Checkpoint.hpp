@@ -0,0 +1,50 @@
+#ifndef FACTORY_CHECKPOINT_HPP_
+#define FACTORY_CHECKPOINT_HPP_
+
+#include <string>
+#include <chrono>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Checkpoint/Checkpointer.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Checkpoint_name;
+extern const std::string Checkpoint_prefix;
+struct Checkpoint : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string          path   = "";                        // path to the checkpoint file (empty = disabled)
+		std::chrono::seconds period = std::chrono::seconds(60); // time between two checkpoints
+		bool                 resume = false;                     // continue the simulation from the checkpoint
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Checkpoint_prefix);
+		virtual ~parameters() = default;
+		Checkpoint::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		bool is_enabled() const;
+
+		// builder
+		tools::Checkpointer* build() const;
+	};
+
+	static tools::Checkpointer* build(const parameters &params);
+};
+}
+}
+
+#endif /* FACTORY_CHECKPOINT_HPP_ */
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <sstream>
+
+#include <mipp.h>
+
+#include "Tools/Parameters/Parameters_args.hpp"
+
+#include "Factory/Codec_generic/Codec_generic.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Codec_generic_name   = "Codec";
+const std::string aff3ct::factory::Codec_generic_prefix = "cde";
+
+Codec_generic::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Codec_generic_name, Codec_generic_name, prefix)
+{
+}
+
+Codec_generic::parameters* Codec_generic::parameters
+::clone() const
+{
+	return new Codec_generic::parameters(*this);
+}
+
+void Codec_generic::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-type"},
+		tools::Text(tools::Including_set("REPETITION", "POLAR", "LDPC", "TURBO", "BCH")),
+		"family of the codec.");
+
+	args.add(
+		{p+"-no-fast"},
+		tools::None(),
+		"keep the default decoder of the library instead of the fastest (SIMD) implementation.");
+
+	args.add(
+		{p+"-inter"},
+		tools::None(),
+		"decode one frame per SIMD lane with the inter-frame SIMD decoder of the family (sets the number of frames "
+		"of all the modules).");
+}
+
+void Codec_generic::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-type"   })) this->type = vals.at({p+"-type"});
+	if(vals.exist({p+"-no-fast"})) this->fast = false;
+	if(vals.exist({p+"-inter"  })) this->inter = true;
+}
+
+void Codec_generic::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	auto p = this->get_prefix();
+
+	// the other headers of the codec come from the parameters of its family
+	headers[p].push_back(std::make_pair("Family", this->type));
+	if (this->fast)
+		headers[p].push_back(std::make_pair("SIMD", mipp::InstructionFullType + " (" +
+		                                            std::to_string(mipp::N<float>()) + " x 32-bit)"));
+	if (this->inter)
+		headers[p].push_back(std::make_pair("Inter-frame SIMD", std::to_string(get_n_frames_inter()) + " frames" +
+		                                    (this->is_reordered() ? " (reordered by the chain)" : "")));
+}
+
+void Codec_generic::parameters
+::pre_parse(int argc, char** argv)
+{
+	const auto type_arg  = "--" + this->get_prefix() + "-type";
+	const auto fast_arg  = "--" + this->get_prefix() + "-no-fast";
+	const auto inter_arg = "--" + this->get_prefix() + "-inter";
+
+	for (auto a = 1; a < argc; a++)
+	{
+		if (type_arg == argv[a] && a +1 < argc)
+			this->type = argv[a +1];
+		if (fast_arg == argv[a])
+			this->fast = false;
+		if (inter_arg == argv[a])
+			this->inter = true;
+	}
+}
+
+Codec_SIHO::parameters* Codec_generic::parameters
+::make_codec() const
+{
+	// the fast implementations are vectorized with MIPP for the instruction set of the build (-march=native): they
+	// are the fastest ones on the CPU that compiled the binary, the inter-frame SIMD decoders are the fast ones
+	const auto fast = this->fast || this->inter;
+
+	Codec_SIHO::parameters* codec = nullptr;
+	if (this->type == "REPETITION")
+	{
+		auto rep = new Codec_repetition_extended::parameters(this->get_prefix());
+		rep->inter    = this->inter;
+		rep->enc_simd = fast;
+		codec = rep;
+		if (fast) { codec->dec->type = "REPETITION";            codec->dec->implem = "SIMD"; }
+	}
+	else if (this->type == "POLAR")
+	{
+		codec = new Codec_polar::parameters(this->get_prefix());
+		if (fast) { codec->dec->type = "SC";                    codec->dec->implem = "FAST"; }
+	}
+	else if (this->type == "LDPC")
+	{
+		codec = new Codec_LDPC::parameters(this->get_prefix());
+		if (fast) { codec->dec->type = "BP_HORIZONTAL_LAYERED"; codec->dec->implem = "NMS";  }
+	}
+	else if (this->type == "TURBO")
+	{
+		codec = new Codec_turbo::parameters(this->get_prefix());
+		if (fast) { codec->dec->type = "TURBO";                 codec->dec->implem = "FAST"; }
+	}
+	else if (this->type == "BCH")
+	{
+		if (this->inter)
+		{
+			std::stringstream message;
+			message << "There is no inter-frame SIMD decoder for the BCH codes.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+		codec = new Codec_BCH::parameters(this->get_prefix());
+		if (fast) { codec->dec->type = "ALGEBRAIC";             codec->dec->implem = "FAST"; }
+	}
+	else
+	{
+		std::stringstream message;
+		message << "Unknown codec family ('type' = " << this->type << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return codec;
+}
+
+void Codec_generic::parameters
+::complete_args(std::vector<std::string> &args, const Codec_SIHO::parameters &codec,
+                const std::vector<Factory::parameters*> &params) const
+{
+	if (!this->inter)
+		return;
+
+	// e.g. the number of frames is given by '-F', '--src-fra', '--enc-fra', ...
+	const std::vector<const Factory::parameters*> list(params.begin(), params.end());
+	auto add = [&args, &list](const std::string &arg, const std::string &value)
+	{
+		if (!tools::argument_exists(list, args, arg))
+		{
+			args.push_back(arg);
+			args.push_back(value);
+		}
+	};
+
+	add("-F", std::to_string(get_n_frames_inter()));
+
+	// the repetition decoder is selected by the codec parameters ('inter')
+	const auto dec = codec.dec->get_prefix();
+	if (this->type == "POLAR" || this->type == "LDPC") add("--" + dec + "-simd",     "INTER");
+	if (this->type == "TURBO"                        ) add("--" + dec + "-sub-simd", "INTER");
+}
+
+bool Codec_generic::parameters
+::is_reordered() const
+{
+	return this->inter && this->type == "REPETITION";
+}
+
+int Codec_generic::parameters
+::get_n_frames_inter()
+{
+	return mipp::N<float>();
+}
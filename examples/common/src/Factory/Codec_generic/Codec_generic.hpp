@@ -0,0 +1,68 @@
+#ifndef FACTORY_CODEC_GENERIC_HPP_
+#define FACTORY_CODEC_GENERIC_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Codec_generic_name;
+extern const std::string Codec_generic_prefix;
+// choose the codec family at runtime: the parameters of the family are created after a first look at the command line
+// (the arguments of the codec depend on its family), then they are parsed with the other parameters
+struct Codec_generic : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string type = "REPETITION"; // codec family
+		bool        fast  = true;        // use the fastest (SIMD) decoder implementation by default
+		bool        inter = false;       // inter-frame SIMD decoder (as many frames as SIMD lanes in all the modules)
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Codec_generic_prefix);
+		virtual ~parameters() = default;
+		Codec_generic::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// read the codec family from the command line (before the parsing of the codec parameters)
+		void pre_parse(int argc, char** argv);
+
+		// create the parameters of the codec family (with the fast decoder by default)
+		Codec_SIHO::parameters* make_codec() const;
+
+		// add the arguments implied by the inter-frame SIMD mode to the command line (the number of frames of all the
+		// modules and the SIMD strategy of the decoder), the arguments given by the user under any of their aliases in
+		// 'params' are kept
+		void complete_args(std::vector<std::string> &args, const Codec_SIHO::parameters &codec,
+		                   const std::vector<Factory::parameters*> &params) const;
+
+		// the decoder works on interleaved frames: the chain has to reorder the frames before and after the decoder
+		// ('module::Reorderer'), the inter-frame decoders of the library reorder the frames themselves
+		bool is_reordered() const;
+
+		// number of frames of the modules in the inter-frame SIMD mode
+		static int get_n_frames_inter();
+	};
+
+	// build the codec from the parameters of any family
+	template <typename B = int, typename Q = float>
+	static module::Codec_SIHO<B,Q>* build(const Codec_SIHO::parameters &params);
+};
+}
+}
+
+#include "Factory/Codec_generic/Codec_generic.hxx"
+
+#endif /* FACTORY_CODEC_GENERIC_HPP_ */
@@ -0,0 +1,23 @@
+#include "Factory/Codec_repetition/Codec_repetition_extended.hpp"
+#include "Factory/Codec_generic/Codec_generic.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+template <typename B, typename Q>
+module::Codec_SIHO<B,Q>* Codec_generic
+::build(const Codec_SIHO::parameters &params)
+{
+	// the 'build' methods of the codec parameters are not virtual (the extended codecs first)
+	if (auto p = dynamic_cast<const Codec_repetition_extended::parameters*>(&params)) return p->template build<B,Q>();
+	if (auto p = dynamic_cast<const Codec_repetition::parameters*>(&params)) return p->template build<B,Q>();
+	if (auto p = dynamic_cast<const Codec_polar     ::parameters*>(&params)) return p->template build<B,Q>();
+	if (auto p = dynamic_cast<const Codec_LDPC      ::parameters*>(&params)) return p->template build<B,Q>();
+	if (auto p = dynamic_cast<const Codec_turbo     ::parameters*>(&params)) return p->template build<B,Q>();
+	if (auto p = dynamic_cast<const Codec_BCH       ::parameters*>(&params)) return p->template build<B,Q>();
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+}
+}
@@ -0,0 +1,49 @@
+#include "Factory/Codec_repetition/Codec_repetition_extended.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+Codec_repetition_extended::parameters
+::parameters(const std::string &prefix)
+: Codec_repetition::parameters(prefix)
+{
+}
+
+Codec_repetition_extended::parameters* Codec_repetition_extended::parameters
+::clone() const
+{
+	return new Codec_repetition_extended::parameters(*this);
+}
+
+void Codec_repetition_extended::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Codec_repetition::parameters::get_description(args);
+
+	// intra-frame SIMD decoder for any K and any repetition factor ('module::Decoder_repetition_simd')
+	tools::add_options(args.at({this->dec->get_prefix()+"-implem"}), 0, "SIMD");
+
+	args.add(
+		{this->enc->get_prefix()+"-simd"},
+		tools::None(),
+		"SIMD encoder with streaming stores, the modulation is fused in the encoder with the 'BPSK' modem.");
+}
+
+void Codec_repetition_extended::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Codec_repetition::parameters::store(vals);
+
+	if(vals.exist({this->enc->get_prefix()+"-simd"})) this->enc_simd = true;
+}
+
+void Codec_repetition_extended::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Codec_repetition::parameters::get_headers(headers, full);
+
+	if (this->enc_simd)
+		headers[this->enc->get_prefix()].push_back(std::make_pair("Implementation", "SIMD"));
+	if (this->inter)
+		headers[this->dec->get_prefix()].push_back(std::make_pair("SIMD strategy", "INTER"));
+}
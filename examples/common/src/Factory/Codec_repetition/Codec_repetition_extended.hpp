@@ -0,0 +1,50 @@
+#ifndef FACTORY_CODEC_REPETITION_EXTENDED_HPP_
+#define FACTORY_CODEC_REPETITION_EXTENDED_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Module/Codec/Repetition/Codec_repetition_extended.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+// the repetition codec of the library + the encoder and the decoders of the examples (SIMD encoder, inter-frame SIMD
+// decoder and "SIMD" implementation of the decoder)
+struct Codec_repetition_extended : Codec_repetition
+{
+	class parameters : public Codec_repetition::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		bool inter    = false; // inter-frame SIMD decoder, the frames have to be interleaved ('module::Reorderer')
+		bool enc_simd = false; // SIMD encoder with the fused BPSK modulation ('module::Encoder_repetition_simd')
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Codec_repetition_prefix);
+		virtual ~parameters() = default;
+		Codec_repetition_extended::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int, typename Q = float>
+		module::Codec_repetition_extended<B,Q>* build() const;
+	};
+
+	template <typename B = int, typename Q = float>
+	static module::Codec_repetition_extended<B,Q>* build(const parameters &params);
+};
+}
+}
+
+#include "Factory/Codec_repetition/Codec_repetition_extended.hxx"
+
+#endif /* FACTORY_CODEC_REPETITION_EXTENDED_HPP_ */
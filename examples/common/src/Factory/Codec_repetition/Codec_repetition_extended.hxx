@@ -0,0 +1,23 @@
+#include "Factory/Codec_repetition/Codec_repetition_extended.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+template <typename B, typename Q>
+module::Codec_repetition_extended<B,Q>* Codec_repetition_extended::parameters
+::build() const
+{
+	return new module::Codec_repetition_extended<B,Q>(dynamic_cast<const Encoder_repetition::parameters&>(*this->enc),
+	                                                  dynamic_cast<const Decoder_repetition::parameters&>(*this->dec),
+	                                                  this->inter, this->enc_simd);
+}
+
+template <typename B, typename Q>
+module::Codec_repetition_extended<B,Q>* Codec_repetition_extended
+::build(const parameters &params)
+{
+	return params.template build<B,Q>();
+}
+}
+}
@@ -0,0 +1,71 @@
+#include "Factory/Engine/Engine.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Engine_name   = "Engine";
+const std::string aff3ct::factory::Engine_prefix = "eng";
+
+Engine::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Engine_name, Engine_name, prefix)
+{
+}
+
+Engine::parameters* Engine::parameters
+::clone() const
+{
+	return new Engine::parameters(*this);
+}
+
+void Engine::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-type", "engine"},
+		tools::Text(tools::Including_set("DIRECT", "TASKS", "OMP", "PIPELINE", "SYSTEMC")),
+		"execution engine of the chain: calls of the module methods, tasks, replicated chains (OpenMP), transmitter and "
+		"receiver on two threads or SystemC.");
+
+	args.add(
+		{p+"-threads"},
+		tools::Integer(tools::Positive()),
+		"number of threads of the 'OMP' engine (0 = all the OpenMP threads).");
+
+	args.add(
+		{p+"-depth"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of batches of frames in flight between the transmitter and the receiver of the 'PIPELINE' engine.");
+
+	args.add(
+		{p+"-no-stats"},
+		tools::None(),
+		"do not measure the durations of the stages (fast mode of the tasks).");
+}
+
+void Engine::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-type"    })) this->type      = vals.at    ({p+"-type"   });
+	if(vals.exist({p+"-threads" })) this->n_threads = vals.to_int({p+"-threads"});
+	if(vals.exist({p+"-depth"   })) this->depth     = vals.to_int({p+"-depth"  });
+	if(vals.exist({p+"-no-stats"})) this->stats     = false;
+}
+
+void Engine::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Type", this->type));
+	if (this->type == "OMP")
+		headers[p].push_back(std::make_pair("Threads", this->n_threads ? std::to_string(this->n_threads)
+		                                                               : std::string("all")));
+	if (this->type == "PIPELINE")
+		headers[p].push_back(std::make_pair("Depth (batches)", std::to_string(this->depth)));
+	headers[p].push_back(std::make_pair("Statistics", this->stats ? "on" : "off"));
+}
@@ -0,0 +1,41 @@
+#ifndef FACTORY_ENGINE_HPP_
+#define FACTORY_ENGINE_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Engine_name;
+extern const std::string Engine_prefix;
+struct Engine : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string type      = "TASKS"; // "DIRECT", "TASKS", "OMP", "PIPELINE" or "SYSTEMC"
+		int         n_threads =       0; // number of threads of the 'OMP' engine (0 = all the OpenMP threads)
+		int         depth     =       4; // number of batches of frames in flight between the stages of 'PIPELINE'
+		bool        stats     =    true; // measure the durations of the stages of the chain
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Engine_prefix);
+		virtual ~parameters() = default;
+		Engine::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+	};
+};
+}
+}
+
+#endif /* FACTORY_ENGINE_HPP_ */
@@ -0,0 +1,76 @@
+#include "Factory/Metrics/Metrics.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Metrics_name   = "Metrics";
+const std::string aff3ct::factory::Metrics_prefix = "met";
+
+Metrics::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Metrics_name, Metrics_name, prefix)
+{
+}
+
+Metrics::parameters* Metrics::parameters
+::clone() const
+{
+	return new Metrics::parameters(*this);
+}
+
+void Metrics::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-addr"},
+		tools::Text(),
+		"serve the live metrics in the Prometheus text format on 'unix:PATH' (Unix socket) or 'tcp:PORT' (localhost).");
+
+	args.add(
+		{p+"-period"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of frames between two collections of the task statistics by a simulation thread.");
+}
+
+void Metrics::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-addr"  })) this->address = vals.at    ({p+"-addr"  });
+	if(vals.exist({p+"-period"})) this->period  = vals.to_int({p+"-period"});
+}
+
+void Metrics::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	if (!this->is_enabled())
+		return;
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Address",         this->address               ));
+	headers[p].push_back(std::make_pair("Period (frames)", std::to_string(this->period)));
+}
+
+bool Metrics::parameters
+::is_enabled() const
+{
+	return !this->address.empty();
+}
+
+tools::Metrics_exporter* Metrics::parameters
+::build(const std::vector<const tools::Monitor_snapshot*> &snapshots, const int K,
+        const tools::Stats_reduction *stats) const
+{
+	return new tools::Metrics_exporter(this->address, snapshots, K, stats);
+}
+
+tools::Metrics_exporter* Metrics
+::build(const parameters &params, const std::vector<const tools::Monitor_snapshot*> &snapshots, const int K,
+        const tools::Stats_reduction *stats)
+{
+	return params.build(snapshots, K, stats);
+}
@@ -0,0 +1,52 @@
+#ifndef FACTORY_METRICS_HPP_
+#define FACTORY_METRICS_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Metrics/Metrics_exporter.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Metrics_name;
+extern const std::string Metrics_prefix;
+struct Metrics : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string address = ""; // "unix:PATH" or "tcp:PORT" (empty = no exporter)
+		int         period  = 64; // number of frames between two collections of the task statistics by a thread
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Metrics_prefix);
+		virtual ~parameters() = default;
+		Metrics::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		bool is_enabled() const;
+
+		// builder
+		tools::Metrics_exporter* build(const std::vector<const tools::Monitor_snapshot*> &snapshots, const int K,
+		                               const tools::Stats_reduction *stats = nullptr) const;
+	};
+
+	static tools::Metrics_exporter* build(const parameters &params,
+	                                      const std::vector<const tools::Monitor_snapshot*> &snapshots, const int K,
+	                                      const tools::Stats_reduction *stats = nullptr);
+};
+}
+}
+
+#endif /* FACTORY_METRICS_HPP_ */
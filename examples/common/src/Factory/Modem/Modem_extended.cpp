@@ -0,0 +1,60 @@
+#include <sstream>
+
+#include "Factory/Modem/Modem_extended.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+Modem_extended::parameters
+::parameters(const std::string &prefix)
+: Modem::parameters(prefix)
+{
+}
+
+Modem_extended::parameters* Modem_extended::parameters
+::clone() const
+{
+	return new Modem_extended::parameters(*this);
+}
+
+void Modem_extended::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Modem::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-fast"},
+		tools::None(),
+		"use the vectorized max-log demodulator (square 'QAM' only, the '--" + p + "-max' argument is ignored).");
+}
+
+void Modem_extended::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Modem::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-fast"})) this->fast = true;
+
+	if (this->fast && (this->type != "QAM" || this->bps % 2))
+	{
+		std::stringstream message;
+		message << "The fast demodulator only supports the square QAM ('type' = " << this->type
+		        << ", 'bps' = " << this->bps << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void Modem_extended::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Modem::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->fast)
+		headers[p].push_back(std::make_pair("Demodulator", "fast (SIMD max-log)"));
+}
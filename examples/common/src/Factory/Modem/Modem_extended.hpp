@@ -0,0 +1,46 @@
+#ifndef FACTORY_MODEM_EXTENDED_HPP_
+#define FACTORY_MODEM_EXTENDED_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+// the modems of the library + the modems of the examples
+struct Modem_extended : Modem
+{
+	class parameters : public Modem::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		bool fast = false; // vectorized max-log demodulator ('QAM' only)
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Modem_prefix);
+		virtual ~parameters() = default;
+		Modem_extended::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder
+		template <typename B = int, typename R = float, typename Q = R>
+		module::Modem<B,R,Q>* build() const;
+	};
+
+	template <typename B = int, typename R = float, typename Q = R>
+	static module::Modem<B,R,Q>* build(const parameters &params);
+};
+}
+}
+
+#include "Factory/Modem/Modem_extended.hxx"
+
+#endif /* FACTORY_MODEM_EXTENDED_HPP_ */
@@ -0,0 +1,25 @@
+#include "Module/Modem/QAM/Modem_QAM_fast.hpp"
+#include "Factory/Modem/Modem_extended.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+template <typename B, typename R, typename Q>
+module::Modem<B,R,Q>* Modem_extended::parameters
+::build() const
+{
+	if (this->type == "QAM" && this->fast)
+		return new module::Modem_QAM_fast<B,R,Q>(this->N, tools::Sigma<R>(), this->bps, this->no_sig2, this->n_frames);
+
+	return Modem::parameters::build<B,R,Q>();
+}
+
+template <typename B, typename R, typename Q>
+module::Modem<B,R,Q>* Modem_extended
+::build(const parameters &params)
+{
+	return params.template build<B,R,Q>();
+}
+}
+}
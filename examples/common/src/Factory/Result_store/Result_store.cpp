@@ -0,0 +1,74 @@
+#include "Factory/Result_store/Result_store.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Result_store_name   = "Result store";
+const std::string aff3ct::factory::Result_store_prefix = "sto";
+
+Result_store::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Result_store_name, Result_store_name, prefix)
+{
+}
+
+Result_store::parameters* Result_store::parameters
+::clone() const
+{
+	return new Result_store::parameters(*this);
+}
+
+void Result_store::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-path"},
+		tools::Text(),
+		"path to the store of the simulated SNR points (the stored points are skipped, the new ones are appended).");
+
+	args.add(
+		{p+"-no-lookup"},
+		tools::None(),
+		"simulate the SNR points even if they are already in the store (the new results are still appended).");
+}
+
+void Result_store::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-path"     })) this->path   = vals.at({p+"-path"});
+	if(vals.exist({p+"-no-lookup"})) this->lookup = false;
+}
+
+void Result_store::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	if (!this->is_enabled())
+		return;
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Path",   this->path                 ));
+	headers[p].push_back(std::make_pair("Lookup", this->lookup ? "yes" : "no"));
+}
+
+bool Result_store::parameters
+::is_enabled() const
+{
+	return !this->path.empty();
+}
+
+tools::Result_store* Result_store::parameters
+::build() const
+{
+	return new tools::Result_store(this->path);
+}
+
+tools::Result_store* Result_store
+::build(const parameters &params)
+{
+	return params.build();
+}
@@ -0,0 +1,48 @@
+#ifndef FACTORY_RESULT_STORE_HPP_
+#define FACTORY_RESULT_STORE_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Store/Result_store.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Result_store_name;
+extern const std::string Result_store_prefix;
+struct Result_store : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string path   = ""; // path to the store (empty = no store)
+		bool        lookup = true; // skip the SNR points that are already in the store
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Result_store_prefix);
+		virtual ~parameters() = default;
+		Result_store::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		bool is_enabled() const;
+
+		// builder
+		tools::Result_store* build() const;
+	};
+
+	static tools::Result_store* build(const parameters &params);
+};
+}
+}
+
+#endif /* FACTORY_RESULT_STORE_HPP_ */
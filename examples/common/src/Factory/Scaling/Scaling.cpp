@@ -0,0 +1,97 @@
+#include "Factory/Scaling/Scaling.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Scaling_name   = "Scaling";
+const std::string aff3ct::factory::Scaling_prefix = "scl";
+
+Scaling::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Scaling_name, Scaling_name, prefix)
+{
+}
+
+Scaling::parameters* Scaling::parameters
+::clone() const
+{
+	return new Scaling::parameters(*this);
+}
+
+void Scaling::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-mode"},
+		tools::Text(tools::Including_set("STRONG", "WEAK", "BOTH")),
+		"strong scaling (fixed total number of frames), weak scaling (fixed number of frames per thread) or both.");
+
+	args.add(
+		{p+"-frames"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"total number of frames of a strong scaling run.");
+
+	args.add(
+		{p+"-frames-thread"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"number of frames per thread of a weak scaling run.");
+
+	args.add(
+		{p+"-threads"},
+		tools::Integer(tools::Positive()),
+		"largest number of threads (0 = all the hardware threads).");
+
+	args.add(
+		{p+"-ebn0"},
+		tools::Real(),
+		"SNR of the simulated frames (Eb/N0 in dB).");
+
+	args.add(
+		{p+"-csv"},
+		tools::Text(),
+		"path to a CSV file for the results (one row per run).");
+}
+
+void Scaling::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-mode"         })) this->mode          =           vals.at      ({p+"-mode"         });
+	if(vals.exist({p+"-frames"       })) this->frames        = (uint64_t)vals.to_int  ({p+"-frames"       });
+	if(vals.exist({p+"-frames-thread"})) this->frames_thread = (uint64_t)vals.to_int  ({p+"-frames-thread"});
+	if(vals.exist({p+"-threads"      })) this->max_threads   =           vals.to_int  ({p+"-threads"      });
+	if(vals.exist({p+"-ebn0"         })) this->ebn0          =           vals.to_float({p+"-ebn0"         });
+	if(vals.exist({p+"-csv"          })) this->csv_path      =           vals.at      ({p+"-csv"          });
+}
+
+void Scaling::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Mode", this->mode));
+	if (this->is_strong())
+		headers[p].push_back(std::make_pair("Frames (strong)", std::to_string(this->frames)));
+	if (this->is_weak())
+		headers[p].push_back(std::make_pair("Frames per thread (weak)", std::to_string(this->frames_thread)));
+	headers[p].push_back(std::make_pair("Max. threads", this->max_threads ? std::to_string(this->max_threads)
+	                                                                      : std::string("all")));
+	headers[p].push_back(std::make_pair("Eb/N0 (dB)", std::to_string(this->ebn0)));
+	if (!this->csv_path.empty())
+		headers[p].push_back(std::make_pair("CSV", this->csv_path));
+}
+
+bool Scaling::parameters
+::is_strong() const
+{
+	return this->mode == "STRONG" || this->mode == "BOTH";
+}
+
+bool Scaling::parameters
+::is_weak() const
+{
+	return this->mode == "WEAK" || this->mode == "BOTH";
+}
@@ -0,0 +1,47 @@
+#ifndef FACTORY_SCALING_HPP_
+#define FACTORY_SCALING_HPP_
+
+#include <cstdint>
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Scaling_name;
+extern const std::string Scaling_prefix;
+struct Scaling : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string mode          = "BOTH";  // "STRONG", "WEAK" or "BOTH"
+		uint64_t    frames        = 200000;  // total number of frames of a strong scaling run
+		uint64_t    frames_thread =  20000;  // number of frames per thread of a weak scaling run
+		int         max_threads   =      0;  // largest number of threads (0 = all the hardware threads)
+		float       ebn0          =   4.00f; // SNR of the frames
+		std::string csv_path      =     "";  // CSV output file (empty = no CSV)
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Scaling_prefix);
+		virtual ~parameters() = default;
+		Scaling::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		bool is_strong() const;
+		bool is_weak  () const;
+	};
+};
+}
+}
+
+#endif /* FACTORY_SCALING_HPP_ */
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <thread>
+
+#include "Factory/Sweep/Sweep.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Sweep_name   = "Sweep";
+const std::string aff3ct::factory::Sweep_prefix = "swp";
+
+Sweep::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Sweep_name, Sweep_name, prefix)
+{
+}
+
+Sweep::parameters* Sweep::parameters
+::clone() const
+{
+	return new Sweep::parameters(*this);
+}
+
+void Sweep::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-params"},
+		tools::Text(),
+		"swept parameters separated by ';', each one is an argument followed by a list or a range of values: "
+		"'ARG=v1,v2,v3', 'ARG=min:step:max' or 'ARG=min:xfactor:max' (ex: \"-K=32,64;-N=128:x2:1024\").");
+
+	args.add(
+		{p+"-out"},
+		tools::Text(),
+		"path to the combined result file of the sweep (CSV).");
+
+	args.add(
+		{p+"-threads"},
+		tools::Integer(tools::Positive()),
+		"number of workers running the jobs of the sweep (0 = all the cores).");
+}
+
+void Sweep::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-params" })) this->dimensions = vals.at    ({p+"-params" });
+	if(vals.exist({p+"-out"    })) this->out_path   = vals.at    ({p+"-out"    });
+	if(vals.exist({p+"-threads"})) this->n_threads  = vals.to_int({p+"-threads"});
+
+	if (this->n_threads == 0)
+		this->n_threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+void Sweep::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	if (!this->is_enabled())
+		return;
+
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Parameters",  this->dimensions               ));
+	headers[p].push_back(std::make_pair("Output file", this->out_path                 ));
+	headers[p].push_back(std::make_pair("Workers",     std::to_string(this->n_threads)));
+}
+
+bool Sweep::parameters
+::is_enabled() const
+{
+	return !this->dimensions.empty();
+}
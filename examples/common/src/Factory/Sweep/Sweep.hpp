@@ -0,0 +1,42 @@
+#ifndef FACTORY_SWEEP_HPP_
+#define FACTORY_SWEEP_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Sweep_name;
+extern const std::string Sweep_prefix;
+struct Sweep : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string dimensions = "";          // e.g. "-K=32,64,128;-N=128:x2:1024;--mdm-type=BPSK,PAM"
+		std::string out_path   = "sweep.csv"; // combined result file of all the jobs
+		int         n_threads  = 0;           // number of workers (0 = all the cores)
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Sweep_prefix);
+		virtual ~parameters() = default;
+		Sweep::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		bool is_enabled() const;
+	};
+};
+}
+}
+
+#endif /* FACTORY_SWEEP_HPP_ */
@@ -0,0 +1,78 @@
+#include "Tools/Terminal/Terminal_async.hpp"
+#include "Tools/Terminal/Terminal_json.hpp"
+#include "Factory/Terminal/Terminal_extended.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+Terminal_extended::parameters
+::parameters(const std::string &prefix)
+: Terminal::parameters(prefix)
+{
+}
+
+Terminal_extended::parameters* Terminal_extended::parameters
+::clone() const
+{
+	return new Terminal_extended::parameters(*this);
+}
+
+void Terminal_extended::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	Terminal::parameters::get_description(args);
+
+	auto p = this->get_prefix();
+
+	tools::add_options(args.at({p+"-type"}), 0, "ASYNC", "JSON");
+
+	args.add(
+		{p+"-json-path"},
+		tools::Text(),
+		"file of the JSON lines, or 'fd:N' for an open file descriptor (only for the 'JSON' terminal).");
+}
+
+void Terminal_extended::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	Terminal::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-json-path"})) this->json_path = vals.at({p+"-json-path"});
+}
+
+void Terminal_extended::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	Terminal::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->type == "JSON")
+		headers[p].push_back(std::make_pair("JSON output", this->json_path));
+}
+
+bool Terminal_extended::parameters
+::use_snapshots() const
+{
+	return this->type == "ASYNC" || this->type == "JSON";
+}
+
+tools::Terminal* Terminal_extended::parameters
+::build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters, const tools::Sigma<> *noise) const
+{
+	if (this->type == "ASYNC")
+		return new tools::Terminal_async(reporters);
+	if (this->type == "JSON")
+		return new tools::Terminal_json(reporters, noise, this->json_path);
+
+	return Terminal::parameters::build(reporters);
+}
+
+tools::Terminal* Terminal_extended
+::build(const parameters &params, const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+        const tools::Sigma<> *noise)
+{
+	return params.build(reporters, noise);
+}
@@ -0,0 +1,50 @@
+#ifndef FACTORY_TERMINAL_EXTENDED_HPP_
+#define FACTORY_TERMINAL_EXTENDED_HPP_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace factory
+{
+// the terminals of the library + the terminals of the examples
+struct Terminal_extended : Terminal
+{
+	class parameters : public Terminal::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		std::string json_path = "results.jsonl"; // file (or "fd:N") of the JSON lines ('JSON')
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Terminal_prefix);
+		virtual ~parameters() = default;
+		Terminal_extended::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// the reporters of the monitors have to read the snapshots of the monitors ('tools::Reporter_snapshot')
+		bool use_snapshots() const;
+
+		// builder ('noise' gives the SNR of the JSON lines, it can be null)
+		tools::Terminal* build(const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+		                       const tools::Sigma<> *noise = nullptr) const;
+	};
+
+	static tools::Terminal* build(const parameters &params,
+	                              const std::vector<std::unique_ptr<tools::Reporter>> &reporters,
+	                              const tools::Sigma<> *noise = nullptr);
+};
+}
+}
+
+#endif /* FACTORY_TERMINAL_EXTENDED_HPP_ */
@@ -0,0 +1,78 @@
+#include <chrono>
+
+#include "Factory/Workers/Workers.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::factory;
+
+const std::string aff3ct::factory::Workers_name   = "Workers";
+const std::string aff3ct::factory::Workers_prefix = "wrk";
+
+Workers::parameters
+::parameters(const std::string &prefix)
+: Factory::parameters(Workers_name, Workers_name, prefix)
+{
+}
+
+Workers::parameters* Workers::parameters
+::clone() const
+{
+	return new Workers::parameters(*this);
+}
+
+void Workers::parameters
+::get_description(tools::Argument_map_info &args) const
+{
+	auto p = this->get_prefix();
+
+	args.add(
+		{p+"-adaptive"},
+		tools::None(),
+		"choose the number of active threads at the beginning of each SNR point (the other threads are parked).");
+
+	args.add(
+		{p+"-window"},
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		"duration of a calibration step of the number of active threads (in ms).");
+
+	args.add(
+		{p+"-min-gain"},
+		tools::Real(tools::Positive()),
+		"minimum throughput gain to keep the additional threads of a calibration step (0.05 = 5%).");
+}
+
+void Workers::parameters
+::store(const tools::Argument_map_value &vals)
+{
+	auto p = this->get_prefix();
+
+	if(vals.exist({p+"-adaptive"})) this->adaptive = true;
+	if(vals.exist({p+"-window"  })) this->window   = vals.to_int  ({p+"-window"  });
+	if(vals.exist({p+"-min-gain"})) this->min_gain = vals.to_float({p+"-min-gain"});
+}
+
+void Workers::parameters
+::get_headers(std::map<std::string,header_list>& headers, const bool full) const
+{
+	auto p = this->get_prefix();
+
+	headers[p].push_back(std::make_pair("Adaptive", this->adaptive ? "yes" : "no"));
+	if (this->adaptive)
+	{
+		headers[p].push_back(std::make_pair("Window (ms)", std::to_string(this->window  )));
+		headers[p].push_back(std::make_pair("Min. gain",   std::to_string(this->min_gain)));
+	}
+}
+
+tools::Workers_controller* Workers::parameters
+::build(const size_t n_threads) const
+{
+	return new tools::Workers_controller(n_threads, std::chrono::milliseconds(this->window), this->min_gain,
+	                                     this->adaptive);
+}
+
+tools::Workers_controller* Workers
+::build(const parameters &params, const size_t n_threads)
+{
+	return params.build(n_threads);
+}
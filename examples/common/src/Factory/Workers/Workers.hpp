@@ -0,0 +1,47 @@
+#ifndef FACTORY_WORKERS_HPP_
+#define FACTORY_WORKERS_HPP_
+
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Workers/Workers_controller.hpp"
+
+namespace aff3ct
+{
+namespace factory
+{
+extern const std::string Workers_name;
+extern const std::string Workers_prefix;
+struct Workers : Factory
+{
+	class parameters : public Factory::parameters
+	{
+	public:
+		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		bool  adaptive = false; // park the threads that do not raise the throughput (adds a calibration ramp)
+		int   window   =   200; // duration of a calibration step of the number of workers (in ms)
+		float min_gain = 0.05f; // minimum throughput gain to keep the additional workers (5%)
+
+		// ---------------------------------------------------------------------------------------------------- METHODS
+		explicit parameters(const std::string &p = Workers_prefix);
+		virtual ~parameters() = default;
+		Workers::parameters* clone() const;
+
+		// parameters construction
+		void get_description(tools::Argument_map_info &args) const;
+		void store          (const tools::Argument_map_value &vals);
+		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
+
+		// builder (all the workers are always active when 'adaptive' is false)
+		tools::Workers_controller* build(const size_t n_threads) const;
+	};
+
+	static tools::Workers_controller* build(const parameters &params, const size_t n_threads);
+};
+}
+}
+
+#endif /* FACTORY_WORKERS_HPP_ */
@@ -0,0 +1,82 @@
+#include <mipp.h>
+
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_ring.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename R>
+Channel_AWGN_LLR_ring<R>
+::Channel_AWGN_LLR_ring(const int N, const int seed, const size_t n_producers, const size_t n_blocks,
+                        const tools::Noise<R>& noise, const int n_frames)
+: Channel<R>(N, noise, n_frames),
+  ring((size_t)N, n_blocks, n_producers, seed)
+{
+	const std::string name = "Channel_AWGN_LLR_ring";
+	this->set_name(name);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_ring<R>
+::set_seed(const int seed)
+{
+	this->ring.reset(seed);
+}
+
+template <typename R>
+uint64_t Channel_AWGN_LLR_ring<R>
+::get_n_stalls() const
+{
+	return this->ring.get_n_stalls();
+}
+
+template <typename R>
+void Channel_AWGN_LLR_ring<R>
+::add_noise(const R *X_N, R *Y_N, const int frame_id)
+{
+	this->check_noise();
+
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	for (auto f = f_start; f < f_stop; f++)
+		this->_add_noise(X_N + f * this->N, Y_N + f * this->N, f);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_ring<R>
+::_add_noise(const R *X_N, R *Y_N, const int frame_id)
+{
+	this->_add_scaled_noise(X_N, Y_N, this->n->get_noise());
+}
+
+template <typename R>
+void Channel_AWGN_LLR_ring<R>
+::_add_scaled_noise(const R *X_N, R *Y_N, const R sigma)
+{
+	const auto W_N = this->ring.acquire();
+
+	const auto vec_loop_size = (this->N / mipp::N<R>()) * mipp::N<R>();
+	const mipp::Reg<R> r_sigma = sigma;
+	for (auto i = 0; i < vec_loop_size; i += mipp::N<R>())
+	{
+		mipp::Reg<R> r_x, r_w;
+		r_x.loadu(X_N + i);
+		r_w.loadu(W_N + i);
+		mipp::fmadd(r_w, r_sigma, r_x).storeu(Y_N + i);
+	}
+	for (auto i = vec_loop_size; i < this->N; i++)
+		Y_N[i] = X_N[i] + sigma * W_N[i];
+
+	this->ring.release();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Channel_AWGN_LLR_ring<R_32>;
+template class aff3ct::module::Channel_AWGN_LLR_ring<R_64>;
+#else
+template class aff3ct::module::Channel_AWGN_LLR_ring<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,44 @@
+#ifndef CHANNEL_AWGN_LLR_RING_HPP_
+#define CHANNEL_AWGN_LLR_RING_HPP_
+
+#include <cstdint>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Noise/Noise_ring.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// AWGN channel where the Gaussian noise is generated in advance by background threads (see 'tools::Noise_ring'): the
+// 'add_noise' task only scales the unit-variance noise by sigma and adds it to the frames (Y = X + sigma * W). The
+// noise generation runs on the spare cores (or hyperthreads) in parallel with the rest of the chain.
+template <typename R = float>
+class Channel_AWGN_LLR_ring : public Channel<R>
+{
+protected:
+	tools::Noise_ring<R> ring; // one block of noise per frame
+
+public:
+	Channel_AWGN_LLR_ring(const int N, const int seed = 0, const size_t n_producers = 1, const size_t n_blocks = 64,
+	                      const tools::Noise<R>& noise = tools::Sigma<R>(), const int n_frames = 1);
+	virtual ~Channel_AWGN_LLR_ring() = default;
+
+	void set_seed(const int seed);
+
+	// number of frames that waited for their noise (= the producers are too slow)
+	uint64_t get_n_stalls() const;
+
+	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise;
+
+protected:
+	// one frame (the 'frame_id' of the base class is not used: the blocks of noise are read in order)
+	void _add_noise(const R *X_N, R *Y_N, const int frame_id);
+
+	void _add_scaled_noise(const R *X_N, R *Y_N, const R sigma);
+};
+}
+}
+
+#endif /* CHANNEL_AWGN_LLR_RING_HPP_ */
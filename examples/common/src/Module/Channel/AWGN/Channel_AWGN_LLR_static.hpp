@@ -0,0 +1,38 @@
+#ifndef CHANNEL_AWGN_LLR_STATIC_HPP_
+#define CHANNEL_AWGN_LLR_STATIC_HPP_
+
+#include <array>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Channel_AWGN_LLR' (Y = X + sigma * W), the noise is drawn by the vectorized
+// Gaussian generator of the library
+template <int N, typename R = float>
+class Channel_AWGN_LLR_static
+{
+	static_assert(N > 0, "'N' has to be greater than 0.");
+
+protected:
+	tools::Gaussian_noise_generator_fast<R> gaussgen;
+	std::array<R,N>                         noise;
+	R                                       sigma;
+
+public:
+	explicit Channel_AWGN_LLR_static(const int seed = 0);
+
+	void set_seed (const int seed);
+	void set_sigma(const R sigma);
+	void add_noise(const std::array<R,N> &X_N, std::array<R,N> &Y_N);
+};
+}
+}
+
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_static.hxx"
+
+#endif /* CHANNEL_AWGN_LLR_STATIC_HPP_ */
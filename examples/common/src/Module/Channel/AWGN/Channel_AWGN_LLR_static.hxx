@@ -0,0 +1,36 @@
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int N, typename R>
+Channel_AWGN_LLR_static<N,R>
+::Channel_AWGN_LLR_static(const int seed)
+: gaussgen(seed), sigma((R)1)
+{
+}
+
+template <int N, typename R>
+void Channel_AWGN_LLR_static<N,R>
+::set_seed(const int seed)
+{
+	this->gaussgen.set_seed(seed);
+}
+
+template <int N, typename R>
+void Channel_AWGN_LLR_static<N,R>
+::set_sigma(const R sigma)
+{
+	this->sigma = sigma;
+}
+
+template <int N, typename R>
+void Channel_AWGN_LLR_static<N,R>
+::add_noise(const std::array<R,N> &X_N, std::array<R,N> &Y_N)
+{
+	this->gaussgen.generate(this->noise.data(), (unsigned)N, this->sigma);
+	tools::Unroll<0,N>::apply([&](const int i) { Y_N[i] = X_N[i] + this->noise[i]; });
+}
+}
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename R>
+Channel_Rayleigh_LLR_fast<R>
+::Channel_Rayleigh_LLR_fast(const int N, const bool complex, const int coherence, const int seed,
+                            const tools::Noise<R>& noise, const int n_frames)
+: Channel<R>(N, noise, n_frames),
+  complex(complex),
+  coherence(coherence),
+  n_symbols(complex ? N / 2 : N),
+  n_gains((n_symbols + coherence -1) / (coherence > 0 ? coherence : 1)),
+  gaussgen(seed),
+  gains(2 * n_gains),
+  noise(N)
+{
+	const std::string name = "Channel_Rayleigh_LLR_fast";
+	this->set_name(name);
+
+	if (coherence <= 0)
+	{
+		std::stringstream message;
+		message << "'coherence' has to be greater than 0 ('coherence' = " << coherence << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (complex && (N % 2))
+	{
+		std::stringstream message;
+		message << "'N' has to be a multiple of 2 for a complex channel ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_fast<R>
+::set_seed(const int seed)
+{
+	this->gaussgen.set_seed(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_fast<R>
+::_add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id)
+{
+	const auto sigma = this->n->get_noise();
+
+	// E[|h|^2] = 1: the real and the imaginary parts of the gains have a variance of 1/2
+	this->gaussgen.generate(this->gains.data(), (unsigned)this->gains.size(), (R)std::sqrt((R)0.5));
+	this->gaussgen.generate(this->noise.data(), (unsigned)this->N, sigma);
+
+	const auto G_re = this->gains.data();
+	const auto G_im = this->gains.data() + this->n_gains;
+
+	if (this->complex)
+	{
+		for (auto s = 0; s < this->n_symbols; s++)
+		{
+			const auto g = s / this->coherence;
+			H_N[2 * s   ] = G_re[g];
+			H_N[2 * s +1] = G_im[g];
+		}
+
+		// complex product, the loop is vectorized by the compiler (no shuffle in MIPP for the interleaved layout)
+		for (auto s = 0; s < this->n_symbols; s++)
+		{
+			const auto h_re = H_N[2 * s], h_im = H_N[2 * s +1];
+			const auto x_re = X_N[2 * s], x_im = X_N[2 * s +1];
+			Y_N[2 * s   ] = h_re * x_re - h_im * x_im + this->noise[2 * s   ];
+			Y_N[2 * s +1] = h_re * x_im + h_im * x_re + this->noise[2 * s +1];
+		}
+	}
+	else
+	{
+		// amplitudes of the gains
+		const auto vec_loop_size = (this->n_gains / mipp::N<R>()) * mipp::N<R>();
+		for (auto g = 0; g < vec_loop_size; g += mipp::N<R>())
+		{
+			mipp::Reg<R> r_re, r_im;
+			r_re.load(G_re + g);
+			r_im.loadu(G_im + g);
+			mipp::sqrt(r_re * r_re + r_im * r_im).store(G_re + g);
+		}
+		for (auto g = vec_loop_size; g < this->n_gains; g++)
+			G_re[g] = std::sqrt(G_re[g] * G_re[g] + G_im[g] * G_im[g]);
+
+		if (this->coherence == 1)
+			std::copy(G_re, G_re + this->N, H_N);
+		else
+			for (auto s = 0; s < this->N; s++)
+				H_N[s] = G_re[s / this->coherence];
+
+		const auto vec_loop_size_N = (this->N / mipp::N<R>()) * mipp::N<R>();
+		for (auto i = 0; i < vec_loop_size_N; i += mipp::N<R>())
+		{
+			mipp::Reg<R> r_x, r_h, r_w;
+			r_x.loadu(X_N + i);
+			r_h.loadu(H_N + i);
+			r_w.load(this->noise.data() + i);
+			mipp::fmadd(r_h, r_x, r_w).storeu(Y_N + i);
+		}
+		for (auto i = vec_loop_size_N; i < this->N; i++)
+			Y_N[i] = H_N[i] * X_N[i] + this->noise[i];
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Channel_Rayleigh_LLR_fast<R_32>;
+template class aff3ct::module::Channel_Rayleigh_LLR_fast<R_64>;
+#else
+template class aff3ct::module::Channel_Rayleigh_LLR_fast<R>;
+#endif
+// ==================================================================================== explicit template instantiation
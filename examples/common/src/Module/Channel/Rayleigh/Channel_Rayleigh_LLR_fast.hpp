@@ -0,0 +1,44 @@
+#ifndef CHANNEL_RAYLEIGH_LLR_FAST_HPP_
+#define CHANNEL_RAYLEIGH_LLR_FAST_HPP_
+
+#include <mipp.h>
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// Rayleigh fading channel (Y = H.X + sigma * W) with i.i.d. ('coherence' = 1) or block fading (the same gain for
+// 'coherence' consecutive symbols). The gains are given by the 'H_N' socket of the 'add_noise_wg' task, with the same
+// layout as the frames:
+// - complex channel: H_N = (re, im) of the complex gain of each symbol, E[|h|^2] = 1,
+// - real    channel: H_N = |h| (Rayleigh distributed amplitude of the gain, coherent detection).
+// The gains and the noise are generated by blocks with the vectorized Gaussian generator, the only task of the
+// channel is 'add_noise_wg'.
+template <typename R = float>
+class Channel_Rayleigh_LLR_fast : public Channel<R>
+{
+protected:
+	const bool complex;
+	const int  coherence; // number of consecutive symbols with the same gain
+	const int  n_symbols; // number of symbols per frame (N/2 if complex, N otherwise)
+	const int  n_gains;   // number of gains per frame
+
+	tools::Gaussian_noise_generator_fast<R> gaussgen;
+	mipp::vector<R>                         gains;  // real parts then imaginary parts of the gains (2 x n_gains)
+	mipp::vector<R>                         noise;  // noise of a frame (N)
+
+public:
+	Channel_Rayleigh_LLR_fast(const int N, const bool complex, const int coherence = 1, const int seed = 0,
+	                          const tools::Noise<R>& noise = tools::Sigma<R>(), const int n_frames = 1);
+	virtual ~Channel_Rayleigh_LLR_fast() = default;
+
+	void set_seed(const int seed);
+
+protected:
+	void _add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id);
+};
+}
+}
+
+#endif /* CHANNEL_RAYLEIGH_LLR_FAST_HPP_ */
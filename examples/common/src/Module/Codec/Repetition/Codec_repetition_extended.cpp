@@ -0,0 +1,54 @@
+#include <type_traits>
+
+#include "Module/Encoder/Repetition/Encoder_repetition_simd.hpp"
+#include "Module/Decoder/Repetition/Decoder_repetition_inter.hpp"
+#include "Module/Decoder/Repetition/Decoder_repetition_simd.hpp"
+#include "Module/Codec/Repetition/Codec_repetition_extended.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// the decoder built by the codec of the library is replaced: the standard one accepts any K and N
+static factory::Decoder_repetition::parameters std_decoder(const factory::Decoder_repetition::parameters &dec_params)
+{
+	auto std_params = dec_params;
+	std_params.implem = "STD";
+	return std_params;
+}
+
+template <typename B, typename Q>
+Codec_repetition_extended<B,Q>
+::Codec_repetition_extended(const factory::Encoder_repetition::parameters &enc_params,
+                            const factory::Decoder_repetition::parameters &dec_params,
+                            const bool inter, const bool enc_simd)
+: Codec           <B,Q>(enc_params.K, enc_params.N_cw, enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
+  Codec_repetition<B,Q>(enc_params, inter || dec_params.implem == "SIMD" ? std_decoder(dec_params) : dec_params)
+{
+	const std::string name = "Codec_repetition_extended";
+	this->set_name(name);
+
+	// the symbols of the fused modulation are floating-point values (double with the 64-bit LLRs, float otherwise)
+	using R = typename std::conditional<std::is_same<Q,double>::value, double, float>::type;
+	if (enc_simd)
+		this->set_encoder(new Encoder_repetition_simd<B,R>(enc_params.K, enc_params.N_cw, enc_params.buffered,
+		                                                   enc_params.n_frames));
+
+	if (inter)
+		this->set_decoder_siho(new Decoder_repetition_inter<B,Q>(dec_params.K, dec_params.N_cw, dec_params.buffered,
+		                                                         dec_params.n_frames));
+	else if (dec_params.implem == "SIMD")
+		this->set_decoder_siho(new Decoder_repetition_simd<B,Q>(dec_params.K, dec_params.N_cw, dec_params.buffered,
+		                                                        dec_params.n_frames));
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Codec_repetition_extended<B_8, Q_8>;
+template class aff3ct::module::Codec_repetition_extended<B_16,Q_16>;
+template class aff3ct::module::Codec_repetition_extended<B_32,Q_32>;
+template class aff3ct::module::Codec_repetition_extended<B_64,Q_64>;
+#else
+template class aff3ct::module::Codec_repetition_extended<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,25 @@
+#ifndef CODEC_REPETITION_EXTENDED_HPP_
+#define CODEC_REPETITION_EXTENDED_HPP_
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// repetition codec of the library with the decoders of the examples ('module::Decoder_repetition_inter' when 'inter'
+// is true, 'module::Decoder_repetition_simd' when the implementation of the decoder is "SIMD", the decoder of the
+// library otherwise) and with 'module::Encoder_repetition_simd' when 'enc_simd' is true
+template <typename B = int, typename Q = float>
+class Codec_repetition_extended : public Codec_repetition<B,Q>
+{
+public:
+	Codec_repetition_extended(const factory::Encoder_repetition::parameters &enc_params,
+	                          const factory::Decoder_repetition::parameters &dec_params,
+	                          const bool inter = false, const bool enc_simd = false);
+	virtual ~Codec_repetition_extended() = default;
+};
+}
+}
+
+#endif /* CODEC_REPETITION_EXTENDED_HPP_ */
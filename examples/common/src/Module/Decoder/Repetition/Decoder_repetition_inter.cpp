@@ -0,0 +1,84 @@
+#include <sstream>
+
+#include "Module/Decoder/Repetition/Decoder_repetition_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_repetition_inter<B,R>
+::Decoder_repetition_inter(const int K, const int N, const bool buffered_encoding, const int n_frames)
+: Decoder             (K, N, n_frames, n_frames),
+  Decoder_SIHO<B,R>   (K, N, n_frames, n_frames),
+  rep_count(N / K),
+  buffered_encoding(buffered_encoding),
+  sums(n_frames)
+{
+	const std::string name = "Decoder_repetition_inter";
+	this->set_name(name);
+
+	if (N % K)
+	{
+		std::stringstream message;
+		message << "'N' has to be a multiple of 'K' ('N' = " << N << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+int Decoder_repetition_inter<B,R>
+::position(const int k, const int r) const
+{
+	// buffered encoding: the frame is the information bits repeated 'rep_count' times, otherwise each bit is repeated
+	// 'rep_count' times in a row
+	return this->buffered_encoding ? r * this->K + k : k * this->rep_count + r;
+}
+
+template <typename B, typename R>
+void Decoder_repetition_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	// the whole wave of frames is decoded at once (the inter-frame level is 'n_frames')
+	const auto n_frames      = this->n_frames;
+	const auto vec_loop_size = (n_frames / mipp::N<R>()) * mipp::N<R>();
+
+	for (auto k = 0; k < this->K; k++)
+	{
+		for (auto f = 0; f < vec_loop_size; f += mipp::N<R>())
+		{
+			mipp::Reg<R> r_sum;
+			r_sum.loadu(Y_N + this->position(k, 0) * n_frames + f);
+			for (auto r = 1; r < this->rep_count; r++)
+			{
+				mipp::Reg<R> r_llr;
+				r_llr.loadu(Y_N + this->position(k, r) * n_frames + f);
+				r_sum = r_sum + r_llr;
+			}
+			r_sum.store(this->sums.data() + f);
+		}
+
+		for (auto f = vec_loop_size; f < n_frames; f++)
+		{
+			auto sum = Y_N[this->position(k, 0) * n_frames + f];
+			for (auto r = 1; r < this->rep_count; r++)
+				sum += Y_N[this->position(k, r) * n_frames + f];
+			this->sums[f] = sum;
+		}
+
+		// hard decisions (a negative LLR is a 1)
+		for (auto f = 0; f < n_frames; f++)
+			V_K[k * n_frames + f] = (B)(this->sums[f] < (R)0);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_repetition_inter<B_8, Q_8>;
+template class aff3ct::module::Decoder_repetition_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_repetition_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_repetition_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_repetition_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,35 @@
+#ifndef DECODER_REPETITION_INTER_HPP_
+#define DECODER_REPETITION_INTER_HPP_
+
+#include <mipp.h>
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// inter-frame SIMD repetition decoder: the 'n_frames' frames are decoded at once and have to be interleaved (the LLR i
+// of the frame f is at i * n_frames + f, see 'module::Reorderer'), the decoded bits are interleaved the same way. The
+// LLRs of the repetitions of a bit are summed with vertical SIMD additions (one frame per lane), the code does not
+// have to be vectorizable inside a frame (any K, any repetition factor).
+template <typename B = int, typename R = float>
+class Decoder_repetition_inter : public Decoder_SIHO<B,R>
+{
+protected:
+	const int       rep_count; // number of repetitions of each bit (N / K)
+	const bool      buffered_encoding;
+	mipp::vector<R> sums;      // sums of the LLRs of a bit for each frame (n_frames)
+
+public:
+	Decoder_repetition_inter(const int K, const int N, const bool buffered_encoding = true, const int n_frames = 1);
+	virtual ~Decoder_repetition_inter() = default;
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+
+	inline int position(const int k, const int r) const; // position of the repetition 'r' of the bit 'k' in a frame
+};
+}
+}
+
+#endif /* DECODER_REPETITION_INTER_HPP_ */
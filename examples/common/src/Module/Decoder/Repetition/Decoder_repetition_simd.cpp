@@ -0,0 +1,146 @@
+#include <type_traits>
+#include <sstream>
+
+#include "Module/Decoder/Repetition/Decoder_repetition_simd.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// the comparison mask of the sums selects the bits with a blend when B and R have the same size (same number of
+// lanes), the decisions are scalar otherwise
+template <typename B, typename R>
+static inline void decide_lanes(const R *sums, B *V, std::true_type)
+{
+	const mipp::Reg<R> r_zero = (R)0;
+	const mipp::Reg<B> r_one  = (B)1, r_zero_b = (B)0;
+
+	mipp::Reg<R> r_sum;
+	r_sum.load(sums);
+	mipp::blend(r_one, r_zero_b, r_sum < r_zero).storeu(V);
+}
+
+template <typename B, typename R>
+static inline void decide_lanes(const R *sums, B *V, std::false_type)
+{
+	for (auto l = 0; l < mipp::N<R>(); l++)
+		V[l] = (B)(sums[l] < (R)0);
+}
+
+template <typename B, typename R>
+Decoder_repetition_simd<B,R>
+::Decoder_repetition_simd(const int K, const int N, const bool buffered_encoding, const int n_frames)
+: Decoder          (K, N, n_frames, 1),
+  Decoder_SIHO<B,R>(K, N, n_frames, 1),
+  rep_count(N / K),
+  buffered_encoding(buffered_encoding),
+  sums(K)
+{
+	const std::string name = "Decoder_repetition_simd";
+	this->set_name(name);
+
+	if (N % K)
+	{
+		std::stringstream message;
+		message << "'N' has to be a multiple of 'K' ('N' = " << N << ", 'K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+void Decoder_repetition_simd<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	if (this->buffered_encoding)
+		this->sum_vertical(Y_N);
+	else
+		this->sum_horizontal(Y_N);
+
+	this->decide(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_repetition_simd<B,R>
+::sum_vertical(const R *Y_N)
+{
+	// the repetition 'r' of the bit 'k' is at r * K + k
+	const auto K             = this->K;
+	const auto vec_loop_size = (K / mipp::N<R>()) * mipp::N<R>();
+
+	for (auto k = 0; k < vec_loop_size; k += mipp::N<R>())
+	{
+		mipp::Reg<R> r_sum;
+		r_sum.loadu(Y_N + k);
+		for (auto r = 1; r < this->rep_count; r++)
+		{
+			mipp::Reg<R> r_llr;
+			r_llr.loadu(Y_N + r * K + k);
+			r_sum = r_sum + r_llr;
+		}
+		r_sum.store(this->sums.data() + k);
+	}
+
+	for (auto k = vec_loop_size; k < K; k++)
+	{
+		auto sum = Y_N[k];
+		for (auto r = 1; r < this->rep_count; r++)
+			sum += Y_N[r * K + k];
+		this->sums[k] = sum;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_repetition_simd<B,R>
+::sum_horizontal(const R *Y_N)
+{
+	// the repetition 'r' of the bit 'k' is at k * rep_count + r
+	const auto rep_count     = this->rep_count;
+	const auto vec_loop_size = (rep_count / mipp::N<R>()) * mipp::N<R>();
+
+	for (auto k = 0; k < this->K; k++)
+	{
+		const auto Y_k = Y_N + k * rep_count;
+
+		auto sum = (R)0;
+		if (vec_loop_size)
+		{
+			mipp::Reg<R> r_sum;
+			r_sum.loadu(Y_k);
+			for (auto r = mipp::N<R>(); r < vec_loop_size; r += mipp::N<R>())
+			{
+				mipp::Reg<R> r_llr;
+				r_llr.loadu(Y_k + r);
+				r_sum = r_sum + r_llr;
+			}
+			sum = mipp::sum(r_sum);
+		}
+
+		for (auto r = vec_loop_size; r < rep_count; r++)
+			sum += Y_k[r];
+		this->sums[k] = sum;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_repetition_simd<B,R>
+::decide(B *V_K) const
+{
+	// hard decisions (a negative LLR is a 1)
+	const auto vec_loop_size = (this->K / mipp::N<R>()) * mipp::N<R>();
+	for (auto k = 0; k < vec_loop_size; k += mipp::N<R>())
+		decide_lanes(this->sums.data() + k, V_K + k, std::integral_constant<bool, sizeof(B) == sizeof(R)>());
+
+	for (auto k = vec_loop_size; k < this->K; k++)
+		V_K[k] = (B)(this->sums[k] < (R)0);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_repetition_simd<B_8, Q_8>;
+template class aff3ct::module::Decoder_repetition_simd<B_16,Q_16>;
+template class aff3ct::module::Decoder_repetition_simd<B_32,Q_32>;
+template class aff3ct::module::Decoder_repetition_simd<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_repetition_simd<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
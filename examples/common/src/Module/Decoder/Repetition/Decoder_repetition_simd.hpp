@@ -0,0 +1,37 @@
+#ifndef DECODER_REPETITION_SIMD_HPP_
+#define DECODER_REPETITION_SIMD_HPP_
+
+#include <mipp.h>
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// intra-frame SIMD repetition decoder (any K, any repetition factor). With the buffered encoding the repetitions of K
+// consecutive bits are contiguous: they are summed with vertical SIMD additions (one bit per lane). Otherwise the
+// repetitions of a bit are contiguous: they are summed with SIMD additions and a horizontal reduction. The hard
+// decisions are written with SIMD blends as 0/1 values (one bit per element, as expected by the monitors).
+template <typename B = int, typename R = float>
+class Decoder_repetition_simd : public Decoder_SIHO<B,R>
+{
+protected:
+	const int       rep_count; // number of repetitions of each bit (N / K)
+	const bool      buffered_encoding;
+	mipp::vector<R> sums;      // sums of the LLRs of each bit (K)
+
+public:
+	Decoder_repetition_simd(const int K, const int N, const bool buffered_encoding = true, const int n_frames = 1);
+	virtual ~Decoder_repetition_simd() = default;
+
+protected:
+	void _decode_siho(const R *Y_N, B *V_K, const int frame_id);
+
+	void sum_vertical  (const R *Y_N);
+	void sum_horizontal(const R *Y_N);
+	void decide        (B *V_K) const;
+};
+}
+}
+
+#endif /* DECODER_REPETITION_SIMD_HPP_ */
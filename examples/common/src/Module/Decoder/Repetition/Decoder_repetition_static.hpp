@@ -0,0 +1,29 @@
+#ifndef DECODER_REPETITION_STATIC_HPP_
+#define DECODER_REPETITION_STATIC_HPP_
+
+#include <array>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Decoder_repetition_std' (buffered encoding): the N/K LLRs of each bit are
+// summed and the sign gives the hard decision
+template <int K, int N, typename B = int, typename R = float>
+class Decoder_repetition_static
+{
+	static_assert(K > 0 && N % K == 0, "'N' has to be a multiple of 'K'.");
+
+public:
+	static constexpr int rep_count = N / K;
+
+	void decode_siho(const std::array<R,N> &Y_N, std::array<B,K> &V_K) const;
+};
+}
+}
+
+#include "Module/Decoder/Repetition/Decoder_repetition_static.hxx"
+
+#endif /* DECODER_REPETITION_STATIC_HPP_ */
@@ -0,0 +1,17 @@
+#include "Module/Decoder/Repetition/Decoder_repetition_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int K, int N, typename B, typename R>
+void Decoder_repetition_static<K,N,B,R>
+::decode_siho(const std::array<R,N> &Y_N, std::array<B,K> &V_K) const
+{
+	std::array<R,K> sums;
+	tools::Unroll<0,K>::apply([&](const int k) { sums[k] = Y_N[k]; });
+	tools::Unroll<K,N>::apply([&](const int i) { sums[i % K] += Y_N[i]; });
+	tools::Unroll<0,K>::apply([&](const int k) { V_K[k] = (B)(sums[k] < (R)0); });
+}
+}
+}
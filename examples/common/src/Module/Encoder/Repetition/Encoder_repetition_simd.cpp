@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include "Module/Encoder/Repetition/Encoder_repetition_simd.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// copy with non-temporal stores (SSE2, regular copy on the other architectures): the first elements are copied one by
+// one up to a 16-byte boundary of 'out'
+template <typename T>
+static inline void copy_stream(const T *in, T *out, const int n)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+	constexpr int n_elmts = 16 / sizeof(T);
+
+	auto i = 0;
+	for (; i < n && reinterpret_cast<uintptr_t>(out + i) % 16; i++)
+		out[i] = in[i];
+	for (; i + n_elmts <= n; i += n_elmts)
+		_mm_stream_si128(reinterpret_cast<__m128i*>(out + i),
+		                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+	for (; i < n; i++)
+		out[i] = in[i];
+#else
+	std::copy(in, in + n, out);
+#endif
+}
+
+// the non-temporal stores are weakly ordered: they have to be visible before the next task (or thread) reads them
+static inline void fence_stream()
+{
+#if defined(__SSE2__) || defined(_M_X64)
+	_mm_sfence();
+#endif
+}
+
+template <typename B, typename R>
+Encoder_repetition_simd<B,R>
+::Encoder_repetition_simd(const int K, const int N, const bool buffered_encoding, const int n_frames,
+                          const size_t stream_threshold)
+: Encoder_repetition_sys<B>(K, N, buffered_encoding, n_frames),
+  tsk_encode_bpsk(this->tasks.size()),
+  stream_threshold(stream_threshold),
+  symbols(K)
+{
+	const std::string name = "Encoder_repetition_simd";
+	this->set_name(name);
+
+	auto &p = this->create_task("encode_bpsk");
+	auto ps_U_K = this->template create_socket_in <B>(p, "U_K", this->K * this->n_frames);
+	auto ps_X_N = this->template create_socket_out<R>(p, "X_N", this->N * this->n_frames);
+	this->create_codelet(p, [ps_U_K, ps_X_N](Module &m, Task &t) -> int
+	{
+		static_cast<Encoder_repetition_simd<B,R>&>(m).encode_bpsk(static_cast<const B*>(t[ps_U_K].get_dataptr()),
+		                                                          static_cast<      R*>(t[ps_X_N].get_dataptr()));
+		return 0;
+	});
+}
+
+template <typename B, typename R>
+void Encoder_repetition_simd<B,R>
+::encode_bpsk(const B *U_K, R *X_N, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	for (auto f = f_start; f < f_stop; f++)
+		this->_encode_bpsk(U_K + f * this->K, X_N + f * this->N, f);
+}
+
+template <typename B, typename R>
+void Encoder_repetition_simd<B,R>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	this->repeat(U_K, X_N);
+}
+
+template <typename B, typename R>
+void Encoder_repetition_simd<B,R>
+::_encode_bpsk(const B *U_K, R *X_N, const int frame_id)
+{
+	for (auto k = 0; k < this->K; k++)
+		this->symbols[k] = (R)1 - (R)(U_K[k] + U_K[k]);
+
+	this->repeat(this->symbols.data(), X_N);
+}
+
+template <typename B, typename R>
+template <typename T>
+void Encoder_repetition_simd<B,R>
+::repeat(const T *in, T *out) const
+{
+	const auto K = this->K;
+	const auto N = this->N;
+
+	if (this->buffered_encoding)
+	{
+		if ((size_t)(N * this->n_frames) * sizeof(T) >= this->stream_threshold)
+		{
+			for (auto r = 0; r < this->rep_count; r++)
+				copy_stream(in, out + r * K, K);
+			fence_stream();
+		}
+		else
+		{
+			// 'std::copy' is a 'memmove' (vectorized by the C library)
+			for (auto r = 0; r < this->rep_count; r++)
+				std::copy(in, in + K, out + r * K);
+		}
+	}
+	else
+	{
+		const auto rep_count     = this->rep_count;
+		const auto vec_loop_size = (rep_count / mipp::N<T>()) * mipp::N<T>();
+		for (auto k = 0; k < K; k++)
+		{
+			const mipp::Reg<T> r_bit = in[k];
+			auto out_k = out + k * rep_count;
+			for (auto r = 0; r < vec_loop_size; r += mipp::N<T>())
+				r_bit.storeu(out_k + r);
+			for (auto r = vec_loop_size; r < rep_count; r++)
+				out_k[r] = in[k];
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_repetition_simd<B_8, R_32>;
+template class aff3ct::module::Encoder_repetition_simd<B_16,R_32>;
+template class aff3ct::module::Encoder_repetition_simd<B_32,R_32>;
+template class aff3ct::module::Encoder_repetition_simd<B_64,R_64>;
+#else
+template class aff3ct::module::Encoder_repetition_simd<B,R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,59 @@
+#ifndef ENCODER_REPETITION_SIMD_HPP_
+#define ENCODER_REPETITION_SIMD_HPP_
+
+#include <mipp.h>
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+	namespace encr
+	{
+		enum class tsk : size_t { encode_bpsk, SIZE };
+
+		namespace sck
+		{
+			enum class encode_bpsk : size_t { U_K, X_N, SIZE };
+		}
+	}
+
+// repetition encoder with SIMD copies and broadcasts. With the buffered encoding, the frame is the information bits
+// repeated N/K times: the copies use non-temporal (streaming) stores when the frames of a call are larger than
+// 'stream_threshold' bytes, the codewords then bypass the cache instead of evicting the data of the other tasks.
+// Otherwise each bit is broadcast N/K times with SIMD stores. The 'encode_bpsk' task fuses the encoding and the BPSK
+// modulation (0 -> +1, 1 -> -1, as 'module::Modem_BPSK'): only the K symbols of the information bits are computed,
+// they are repeated like the bits.
+template <typename B = int, typename R = float>
+class Encoder_repetition_simd : public Encoder_repetition_sys<B>
+{
+public:
+	using Encoder_repetition_sys<B>::operator[];
+	inline Task&   operator[](const encr::tsk              t);
+	inline Socket& operator[](const encr::sck::encode_bpsk s);
+
+protected:
+	const size_t    tsk_encode_bpsk;  // index of the 'encode_bpsk' task in the module
+	const size_t    stream_threshold; // minimum size of the frames of a call (bytes) for the non-temporal stores
+	mipp::vector<R> symbols;          // BPSK symbols of the information bits (K)
+
+public:
+	Encoder_repetition_simd(const int K, const int N, const bool buffered_encoding = true, const int n_frames = 1,
+	                        const size_t stream_threshold = 1 << 20);
+	virtual ~Encoder_repetition_simd() = default;
+
+	void encode_bpsk(const B *U_K, R *X_N, const int frame_id = -1);
+
+protected:
+	void _encode     (const B *U_K, B *X_N, const int frame_id);
+	void _encode_bpsk(const B *U_K, R *X_N, const int frame_id);
+
+	template <typename T>
+	void repeat(const T *in, T *out) const; // 'in' (K elements) repeated in 'out' (N elements)
+};
+}
+}
+
+#include "Module/Encoder/Repetition/Encoder_repetition_simd.hxx"
+
+#endif /* ENCODER_REPETITION_SIMD_HPP_ */
@@ -0,0 +1,21 @@
+#include "Module/Encoder/Repetition/Encoder_repetition_simd.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+Task& Encoder_repetition_simd<B,R>
+::operator[](const encr::tsk t)
+{
+	return Module::operator[]((int)this->tsk_encode_bpsk + (int)t);
+}
+
+template <typename B, typename R>
+Socket& Encoder_repetition_simd<B,R>
+::operator[](const encr::sck::encode_bpsk s)
+{
+	return Module::operator[]((int)this->tsk_encode_bpsk)[(int)s];
+}
+}
+}
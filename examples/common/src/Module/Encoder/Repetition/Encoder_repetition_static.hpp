@@ -0,0 +1,29 @@
+#ifndef ENCODER_REPETITION_STATIC_HPP_
+#define ENCODER_REPETITION_STATIC_HPP_
+
+#include <array>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Encoder_repetition_sys' (buffered encoding: the frame is the information
+// bits repeated N/K times)
+template <int K, int N, typename B = int>
+class Encoder_repetition_static
+{
+	static_assert(K > 0 && N % K == 0, "'N' has to be a multiple of 'K'.");
+
+public:
+	static constexpr int rep_count = N / K;
+
+	void encode(const std::array<B,K> &U_K, std::array<B,N> &X_N) const;
+};
+}
+}
+
+#include "Module/Encoder/Repetition/Encoder_repetition_static.hxx"
+
+#endif /* ENCODER_REPETITION_STATIC_HPP_ */
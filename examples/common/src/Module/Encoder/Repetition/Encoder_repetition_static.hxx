@@ -0,0 +1,14 @@
+#include "Module/Encoder/Repetition/Encoder_repetition_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int K, int N, typename B>
+void Encoder_repetition_static<K,N,B>
+::encode(const std::array<B,K> &U_K, std::array<B,N> &X_N) const
+{
+	tools::Unroll<0,N>::apply([&](const int i) { X_N[i] = U_K[i % K]; });
+}
+}
+}
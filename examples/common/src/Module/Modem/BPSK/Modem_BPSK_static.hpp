@@ -0,0 +1,33 @@
+#ifndef MODEM_BPSK_STATIC_HPP_
+#define MODEM_BPSK_STATIC_HPP_
+
+#include <array>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Modem_BPSK' (0 -> +1, 1 -> -1, LLR = 2y / sigma^2)
+template <int N, typename B = int, typename R = float, typename Q = R>
+class Modem_BPSK_static
+{
+	static_assert(N > 0, "'N' has to be greater than 0.");
+
+protected:
+	Q two_on_square_sigma;
+
+public:
+	Modem_BPSK_static();
+
+	void set_sigma (const R sigma);
+	void modulate  (const std::array<B,N> &X_N1, std::array<R,N> &X_N2) const;
+	void demodulate(const std::array<Q,N> &Y_N1, std::array<Q,N> &Y_N2) const;
+};
+}
+}
+
+#include "Module/Modem/BPSK/Modem_BPSK_static.hxx"
+
+#endif /* MODEM_BPSK_STATIC_HPP_ */
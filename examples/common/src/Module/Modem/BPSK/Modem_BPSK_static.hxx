@@ -0,0 +1,36 @@
+#include "Module/Modem/BPSK/Modem_BPSK_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int N, typename B, typename R, typename Q>
+Modem_BPSK_static<N,B,R,Q>
+::Modem_BPSK_static()
+: two_on_square_sigma((Q)2)
+{
+}
+
+template <int N, typename B, typename R, typename Q>
+void Modem_BPSK_static<N,B,R,Q>
+::set_sigma(const R sigma)
+{
+	this->two_on_square_sigma = (Q)((R)2 / (sigma * sigma));
+}
+
+template <int N, typename B, typename R, typename Q>
+void Modem_BPSK_static<N,B,R,Q>
+::modulate(const std::array<B,N> &X_N1, std::array<R,N> &X_N2) const
+{
+	tools::Unroll<0,N>::apply([&](const int i) { X_N2[i] = (R)1 - (R)(X_N1[i] + X_N1[i]); });
+}
+
+template <int N, typename B, typename R, typename Q>
+void Modem_BPSK_static<N,B,R,Q>
+::demodulate(const std::array<Q,N> &Y_N1, std::array<Q,N> &Y_N2) const
+{
+	const auto factor = this->two_on_square_sigma;
+	tools::Unroll<0,N>::apply([&](const int i) { Y_N2[i] = Y_N1[i] * factor; });
+}
+}
+}
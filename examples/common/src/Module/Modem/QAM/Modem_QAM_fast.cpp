@@ -0,0 +1,202 @@
+#include <type_traits>
+#include <algorithm>
+#include <sstream>
+#include <limits>
+#include <cmath>
+
+#include "Module/Modem/QAM/Modem_QAM_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R, typename Q>
+Modem_QAM_fast<B,R,Q>
+::Modem_QAM_fast(const int N, const tools::Noise<R>& noise, const int bits_per_symbol, const bool disable_sig2,
+                 const int n_frames)
+: Modem_QAM<B,R,Q,tools::max>(N, noise, bits_per_symbol, disable_sig2, n_frames),
+  bps_axis(bits_per_symbol / 2),
+  n_levels(1 << (bits_per_symbol / 2)),
+  no_sig2(disable_sig2),
+  levels(n_levels * mipp::N<Q>()),
+  levels_I(n_levels),
+  levels_Q(n_levels),
+  llrs(bps_axis * mipp::N<Q>()),
+  equalized(this->N_mod),
+  gains(this->N_mod)
+{
+	static_assert(std::is_floating_point<Q>::value, "The LLRs have to be floating-point values.");
+
+	const std::string name = "Modem_QAM_fast";
+	this->set_name(name);
+
+	if (bits_per_symbol % 2)
+	{
+		std::stringstream message;
+		message << "'bits_per_symbol' has to be even (square QAM only) ('bits_per_symbol' = " << bits_per_symbol
+		        << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (bits_per_symbol > 2 * max_bps_axis)
+	{
+		std::stringstream message;
+		message << "'bits_per_symbol' has to be smaller or equal to " << 2 * max_bps_axis
+		        << " ('bits_per_symbol' = " << bits_per_symbol << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// levels of the axes, read from the constellation of 'Modem_QAM' (the bits [0, bps/2) are on I, the others on Q)
+	std::vector<B> bits(bits_per_symbol);
+	auto symbol = [&](const int s)
+	{
+		for (auto l = 0; l < bits_per_symbol; l++)
+			bits[l] = (B)((s >> l) & 1);
+		return this->bits_to_symbol(bits.data());
+	};
+
+	for (auto k = 0; k < n_levels; k++)
+	{
+		this->levels_I[k] = (Q)symbol(k           ).real();
+		this->levels_Q[k] = (Q)symbol(k << bps_axis).imag();
+	}
+
+	// the LLRs of an axis do not depend on the other axis only if the constellation is a product of two PAMs
+	for (auto s = 0; s < (1 << bits_per_symbol); s++)
+	{
+		const auto x = symbol(s);
+		if (std::abs((Q)x.real() - this->levels_I[s & (n_levels -1)]) > (Q)1e-5 ||
+		    std::abs((Q)x.imag() - this->levels_Q[s >> bps_axis    ]) > (Q)1e-5)
+		{
+			std::stringstream message;
+			message << "The constellation is not a product of two PAMs.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	for (auto k = 0; k < n_levels; k++)
+		for (auto l = 0; l < mipp::N<Q>(); l++)
+			this->levels[k * mipp::N<Q>() + l] = (l % 2) ? this->levels_Q[k] : this->levels_I[k];
+}
+
+template <typename B, typename R, typename Q>
+void Modem_QAM_fast<B,R,Q>
+::demodulate_axis(const Q y, const std::vector<Q> &axis, const Q inv_sigma2, Q *LLRs, const int n_llrs) const
+{
+	for (auto j = 0; j < n_llrs; j++)
+	{
+		auto min0 = std::numeric_limits<Q>::max();
+		auto min1 = std::numeric_limits<Q>::max();
+		for (auto k = 0; k < this->n_levels; k++)
+		{
+			const auto d = (y - axis[k]) * (y - axis[k]);
+			if ((k >> j) & 1) min1 = std::min(min1, d);
+			else              min0 = std::min(min0, d);
+		}
+		LLRs[j] = (min1 - min0) * inv_sigma2;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void Modem_QAM_fast<B,R,Q>
+::_demodulate(const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	const auto sigma = this->n->get_noise();
+	this->demodulate_axes(Y_N1, nullptr, Y_N2, this->no_sig2 ? (Q)1 : (Q)((R)1 / ((R)2 * sigma * sigma)));
+}
+
+template <typename B, typename R, typename Q>
+void Modem_QAM_fast<B,R,Q>
+::_demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id)
+{
+	// |y - h.s|^2 = |h|^2 |y.conj(h) / |h|^2 - s|^2: the max-log LLRs of the received symbol are the ones of the
+	// equalized symbol scaled by the power of the gain, the axes are still independent
+	for (auto s = 0; s < this->N_mod / 2; s++)
+	{
+		const auto h_re = (Q)H_N[2 * s], h_im = (Q)H_N[2 * s +1];
+		const auto y_re =    Y_N1[2 * s], y_im =    Y_N1[2 * s +1];
+		const auto g    = h_re * h_re + h_im * h_im;
+		const auto inv_g = g > std::numeric_limits<Q>::min() ? (Q)1 / g : (Q)0; // a null gain gives null LLRs
+
+		this->equalized[2 * s   ] = (y_re * h_re + y_im * h_im) * inv_g;
+		this->equalized[2 * s +1] = (y_im * h_re - y_re * h_im) * inv_g;
+		this->gains    [2 * s   ] = g;
+		this->gains    [2 * s +1] = g;
+	}
+
+	const auto sigma = this->n->get_noise();
+	this->demodulate_axes(this->equalized.data(), this->gains.data(), Y_N2,
+	                      this->no_sig2 ? (Q)1 : (Q)((R)1 / ((R)2 * sigma * sigma)));
+}
+
+template <typename B, typename R, typename Q>
+void Modem_QAM_fast<B,R,Q>
+::demodulate_axes(const Q *Y, const Q *G, Q *Y_N2, const Q inv_sigma2)
+{
+	// the axis 'e' (I of the symbol e/2 if e is even, Q otherwise) gives the LLRs [e * bps_axis, (e+1) * bps_axis), the
+	// lanes alternate between I and Q: the vectorized loop needs an even number of lanes
+	const auto n_axes     = this->N_mod;
+	const auto n_vec_axes = (mipp::N<Q>() % 2) ? 0 :
+	                        std::min(n_axes, this->N / this->bps_axis) / mipp::N<Q>() * mipp::N<Q>();
+
+	const mipp::Reg<Q> r_inv_sigma2 = inv_sigma2;
+	const mipp::Reg<Q> r_max        = std::numeric_limits<Q>::max();
+	for (auto e = 0; e < n_vec_axes; e += mipp::N<Q>())
+	{
+		mipp::Reg<Q> r_y;
+		r_y.loadu(Y + e);
+
+		// distances to the levels, the minimums for each bit value are updated on the fly
+		mipp::Reg<Q> min0[max_bps_axis], min1[max_bps_axis];
+		for (auto j = 0; j < this->bps_axis; j++)
+			min0[j] = min1[j] = r_max;
+		for (auto k = 0; k < this->n_levels; k++)
+		{
+			mipp::Reg<Q> r_level;
+			r_level.load(this->levels.data() + k * mipp::N<Q>());
+			const auto r_diff = r_y - r_level;
+			const auto r_d    = r_diff * r_diff;
+			for (auto j = 0; j < this->bps_axis; j++)
+				if ((k >> j) & 1) min1[j] = mipp::min(min1[j], r_d);
+				else              min0[j] = mipp::min(min0[j], r_d);
+		}
+
+		auto r_scale = r_inv_sigma2;
+		if (G != nullptr)
+		{
+			mipp::Reg<Q> r_g;
+			r_g.loadu(G + e);
+			r_scale = r_scale * r_g;
+		}
+
+		for (auto j = 0; j < this->bps_axis; j++)
+			((min1[j] - min0[j]) * r_scale).store(this->llrs.data() + j * mipp::N<Q>());
+
+		// interleave the LLRs of the lanes
+		for (auto l = 0; l < mipp::N<Q>(); l++)
+			for (auto j = 0; j < this->bps_axis; j++)
+				Y_N2[(e + l) * this->bps_axis + j] = this->llrs[j * mipp::N<Q>() + l];
+	}
+
+	// the last axes (and the padding bits of the last symbol)
+	Q tail[max_bps_axis];
+	for (auto e = n_vec_axes; e < n_axes; e++)
+	{
+		const auto n_llrs = std::min(this->bps_axis, this->N - e * this->bps_axis);
+		if (n_llrs <= 0)
+			break;
+
+		const auto scale = G != nullptr ? inv_sigma2 * G[e] : inv_sigma2;
+		this->demodulate_axis(Y[e], (e % 2) ? this->levels_Q : this->levels_I, scale, tail, this->bps_axis);
+		std::copy(tail, tail + n_llrs, Y_N2 + e * this->bps_axis);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Modem_QAM_fast<B_32,R_32,R_32>;
+template class aff3ct::module::Modem_QAM_fast<B_64,R_64,R_64>;
+#else
+template class aff3ct::module::Modem_QAM_fast<B,R,R>;
+#endif
+// ==================================================================================== explicit template instantiation
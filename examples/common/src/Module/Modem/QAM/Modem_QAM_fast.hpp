@@ -0,0 +1,53 @@
+#ifndef MODEM_QAM_FAST_HPP_
+#define MODEM_QAM_FAST_HPP_
+
+#include <vector>
+
+#include <mipp.h>
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// square QAM modem with a vectorized max-log demodulator. The constellation (and the modulation) is the one of
+// 'Modem_QAM'. A square QAM is the product of two PAMs (I and Q axes): the max-log LLR of a bit only depends on its
+// axis, it is the difference between the smallest distance to a level where the bit is 1 and the smallest distance to
+// a level where it is 0 (= piecewise-linear in the received value). The levels of each axis are stored in LUTs and the
+// symbols are processed in parallel (one symbol axis per SIMD lane), the result is the same as the max-log of
+// 'Modem_QAM' at a fraction of the cost (2 x 2^(bps/2) distances per symbol instead of 2^bps). With the channel gains
+// ('demodulate_wg', complex gain of each symbol) the symbols are equalized before the demodulation of their axes.
+template <typename B = int, typename R = float, typename Q = R>
+class Modem_QAM_fast : public Modem_QAM<B,R,Q,tools::max>
+{
+protected:
+	static constexpr int max_bps_axis = 8; // up to 65536-QAM
+
+	const int       bps_axis;   // number of bits per axis (= bps / 2)
+	const int       n_levels;   // number of levels per axis (= 2^bps_axis)
+	const bool      no_sig2;
+	mipp::vector<Q> levels;     // level k of each lane (I on the even lanes, Q on the odd ones): n_levels x mipp::N<Q>()
+	std::vector<Q>  levels_I;   // level of each bit pattern on the I axis
+	std::vector<Q>  levels_Q;   // level of each bit pattern on the Q axis
+	mipp::vector<Q> llrs;       // LLRs of the lanes before their interleaving: bps_axis x mipp::N<Q>()
+	std::vector<Q>  equalized;  // received symbols divided by their channel gain ('demodulate_wg')
+	std::vector<Q>  gains;      // power of the channel gain of each axis ('demodulate_wg')
+
+public:
+	Modem_QAM_fast(const int N, const tools::Noise<R>& noise = tools::Sigma<R>(), const int bits_per_symbol = 2,
+	               const bool disable_sig2 = false, const int n_frames = 1);
+	virtual ~Modem_QAM_fast() = default;
+
+protected:
+	void _demodulate   (                const Q *Y_N1, Q *Y_N2, const int frame_id);
+	void _demodulate_wg(const R *H_N, const Q *Y_N1, Q *Y_N2, const int frame_id);
+
+	void demodulate_axes(const Q *Y, const Q *G, Q *Y_N2, const Q inv_sigma2);
+
+	inline void demodulate_axis(const Q y, const std::vector<Q> &axis, const Q inv_sigma2, Q *LLRs,
+	                            const int n_llrs) const;
+};
+}
+}
+
+#endif /* MODEM_QAM_FAST_HPP_ */
@@ -0,0 +1,30 @@
+#include "Module/Monitor/BFER/Monitor_BFER_AZCW.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B>
+Monitor_BFER_AZCW<B>
+::Monitor_BFER_AZCW(const int K, const unsigned max_fe, const unsigned max_n_frames, const bool count_unknown_values,
+                    const int n_frames)
+: Monitor_BFER<B>(K, max_fe, max_n_frames, count_unknown_values, n_frames),
+  zeros((size_t)K * (size_t)n_frames, (B)0)
+{
+	const std::string name = "Monitor_BFER_AZCW";
+	this->set_name(name);
+
+	// the distance to a constant frame of zeros = the number of non-zero decoded bits
+	(*this)[mnt::sck::check_errors::U].bind(const_cast<B*>(this->zeros.data()));
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Monitor_BFER_AZCW<B_8>;
+template class aff3ct::module::Monitor_BFER_AZCW<B_16>;
+template class aff3ct::module::Monitor_BFER_AZCW<B_32>;
+template class aff3ct::module::Monitor_BFER_AZCW<B_64>;
+#else
+template class aff3ct::module::Monitor_BFER_AZCW<B>;
+#endif
+// ==================================================================================== explicit template instantiation
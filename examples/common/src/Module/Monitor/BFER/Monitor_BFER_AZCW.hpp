@@ -0,0 +1,29 @@
+#ifndef MONITOR_BFER_AZCW_HPP_
+#define MONITOR_BFER_AZCW_HPP_
+
+#include <vector>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+// monitor of an all-zero codeword simulation: the errors are the non-zero decoded bits. The 'U' input socket of the
+// 'check_errors' task is bound to an internal buffer of zeros by the constructor, only 'V' has to be bound: the
+// source does not have to be in the simulation loop.
+template <typename B = int>
+class Monitor_BFER_AZCW : public Monitor_BFER<B>
+{
+protected:
+	const std::vector<B> zeros; // the reference frames (K x n_frames)
+
+public:
+	Monitor_BFER_AZCW(const int K, const unsigned max_fe, const unsigned max_n_frames = 0,
+	                  const bool count_unknown_values = false, const int n_frames = 1);
+	virtual ~Monitor_BFER_AZCW() = default;
+};
+}
+}
+
+#endif /* MONITOR_BFER_AZCW_HPP_ */
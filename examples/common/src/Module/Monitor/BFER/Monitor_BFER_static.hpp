@@ -0,0 +1,43 @@
+#ifndef MONITOR_BFER_STATIC_HPP_
+#define MONITOR_BFER_STATIC_HPP_
+
+#include <cstdint>
+#include <array>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Monitor_BFER': counts the bit and the frame errors
+template <int K, typename B = int>
+class Monitor_BFER_static
+{
+	static_assert(K > 0, "'K' has to be greater than 0.");
+
+protected:
+	const uint64_t n_frame_errors; // maximum number of frame errors (0 = no limit)
+	uint64_t       n_analyzed_frames;
+	uint64_t       n_bit_errors;
+	uint64_t       n_frame_errors_cur;
+
+public:
+	explicit Monitor_BFER_static(const uint64_t n_frame_errors = 100);
+
+	int check_errors(const std::array<B,K> &U, const std::array<B,K> &V);
+
+	bool     fe_limit_achieved () const;
+	uint64_t get_n_analyzed_fra() const;
+	uint64_t get_n_be          () const;
+	uint64_t get_n_fe          () const;
+	double   get_ber           () const;
+	double   get_fer           () const;
+	void     reset             ();
+};
+}
+}
+
+#include "Module/Monitor/BFER/Monitor_BFER_static.hxx"
+
+#endif /* MONITOR_BFER_STATIC_HPP_ */
@@ -0,0 +1,78 @@
+#include "Module/Monitor/BFER/Monitor_BFER_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int K, typename B>
+Monitor_BFER_static<K,B>
+::Monitor_BFER_static(const uint64_t n_frame_errors)
+: n_frame_errors(n_frame_errors), n_analyzed_frames(0), n_bit_errors(0), n_frame_errors_cur(0)
+{
+}
+
+template <int K, typename B>
+int Monitor_BFER_static<K,B>
+::check_errors(const std::array<B,K> &U, const std::array<B,K> &V)
+{
+	int n_be = 0;
+	tools::Unroll<0,K>::apply([&](const int i) { n_be += (int)(U[i] != V[i]); });
+
+	this->n_analyzed_frames++;
+	this->n_bit_errors       += (uint64_t)n_be;
+	this->n_frame_errors_cur += (uint64_t)(n_be > 0);
+	return n_be;
+}
+
+template <int K, typename B>
+bool Monitor_BFER_static<K,B>
+::fe_limit_achieved() const
+{
+	return this->n_frame_errors != 0 && this->n_frame_errors_cur >= this->n_frame_errors;
+}
+
+template <int K, typename B>
+uint64_t Monitor_BFER_static<K,B>
+::get_n_analyzed_fra() const
+{
+	return this->n_analyzed_frames;
+}
+
+template <int K, typename B>
+uint64_t Monitor_BFER_static<K,B>
+::get_n_be() const
+{
+	return this->n_bit_errors;
+}
+
+template <int K, typename B>
+uint64_t Monitor_BFER_static<K,B>
+::get_n_fe() const
+{
+	return this->n_frame_errors_cur;
+}
+
+template <int K, typename B>
+double Monitor_BFER_static<K,B>
+::get_ber() const
+{
+	return this->n_analyzed_frames ? (double)this->n_bit_errors / ((double)this->n_analyzed_frames * K) : 0.;
+}
+
+template <int K, typename B>
+double Monitor_BFER_static<K,B>
+::get_fer() const
+{
+	return this->n_analyzed_frames ? (double)this->n_frame_errors_cur / (double)this->n_analyzed_frames : 0.;
+}
+
+template <int K, typename B>
+void Monitor_BFER_static<K,B>
+::reset()
+{
+	this->n_analyzed_frames  = 0;
+	this->n_bit_errors       = 0;
+	this->n_frame_errors_cur = 0;
+}
+}
+}
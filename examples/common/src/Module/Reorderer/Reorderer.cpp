@@ -0,0 +1,97 @@
+#include <sstream>
+
+#include "Module/Reorderer/Reorderer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename Q>
+Reorderer<B,Q>
+::Reorderer(const int K, const int N, const int n_frames)
+: Module(n_frames), K(K), N(N)
+{
+	const std::string name = "Reorderer";
+	this->set_name(name);
+	this->set_short_name(name);
+
+	if (K <= 0)
+	{
+		std::stringstream message;
+		message << "'K' has to be greater than 0 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N <= 0)
+	{
+		std::stringstream message;
+		message << "'N' has to be greater than 0 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto &p1 = this->create_task("reorder");
+	auto p1s_Y_N1 = this->template create_socket_in <Q>(p1, "Y_N1", this->N * this->n_frames);
+	auto p1s_Y_N2 = this->template create_socket_out<Q>(p1, "Y_N2", this->N * this->n_frames);
+	this->create_codelet(p1, [p1s_Y_N1, p1s_Y_N2](Module &m, Task &t) -> int
+	{
+		static_cast<Reorderer<B,Q>&>(m).reorder(static_cast<const Q*>(t[p1s_Y_N1].get_dataptr()),
+		                                        static_cast<      Q*>(t[p1s_Y_N2].get_dataptr()));
+		return 0;
+	});
+
+	auto &p2 = this->create_task("reorder_rev");
+	auto p2s_V_K1 = this->template create_socket_in <B>(p2, "V_K1", this->K * this->n_frames);
+	auto p2s_V_K2 = this->template create_socket_out<B>(p2, "V_K2", this->K * this->n_frames);
+	this->create_codelet(p2, [p2s_V_K1, p2s_V_K2](Module &m, Task &t) -> int
+	{
+		static_cast<Reorderer<B,Q>&>(m).reorder_rev(static_cast<const B*>(t[p2s_V_K1].get_dataptr()),
+		                                            static_cast<      B*>(t[p2s_V_K2].get_dataptr()));
+		return 0;
+	});
+}
+
+template <typename B, typename Q>
+int Reorderer<B,Q>
+::get_K() const
+{
+	return this->K;
+}
+
+template <typename B, typename Q>
+int Reorderer<B,Q>
+::get_N() const
+{
+	return this->N;
+}
+
+template <typename B, typename Q>
+void Reorderer<B,Q>
+::reorder(const Q *Y_N1, Q *Y_N2) const
+{
+	// the writes are contiguous, the reads are strided (one element per frame)
+	const auto n_frames = this->n_frames;
+	for (auto i = 0; i < this->N; i++)
+		for (auto f = 0; f < n_frames; f++)
+			Y_N2[i * n_frames + f] = Y_N1[f * this->N + i];
+}
+
+template <typename B, typename Q>
+void Reorderer<B,Q>
+::reorder_rev(const B *V_K1, B *V_K2) const
+{
+	const auto n_frames = this->n_frames;
+	for (auto f = 0; f < n_frames; f++)
+		for (auto i = 0; i < this->K; i++)
+			V_K2[f * this->K + i] = V_K1[i * n_frames + f];
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Reorderer<B_8, Q_8>;
+template class aff3ct::module::Reorderer<B_16,Q_16>;
+template class aff3ct::module::Reorderer<B_32,Q_32>;
+template class aff3ct::module::Reorderer<B_64,Q_64>;
+#else
+template class aff3ct::module::Reorderer<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,51 @@
+#ifndef REORDERER_HPP_
+#define REORDERER_HPP_
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace module
+{
+	namespace rdr
+	{
+		enum class tsk : size_t { reorder, reorder_rev, SIZE };
+
+		namespace sck
+		{
+			enum class reorder     : size_t { Y_N1, Y_N2, SIZE };
+			enum class reorder_rev : size_t { V_K1, V_K2, SIZE };
+		}
+	}
+
+// transposition of the frames for the inter-frame SIMD decoders: the 'reorder' task interleaves the 'n_frames' frames
+// of LLRs (the element i of the frame f goes to i * n_frames + f, the frames are in the SIMD lanes) and the
+// 'reorder_rev' task puts the decoded bits back in the natural order (the frame f is in [f * K, (f+1) * K))
+template <typename B = int, typename Q = float>
+class Reorderer : public Module
+{
+public:
+	inline Task&   operator[](const rdr::tsk              t);
+	inline Socket& operator[](const rdr::sck::reorder     s);
+	inline Socket& operator[](const rdr::sck::reorder_rev s);
+
+protected:
+	const int K; // number of bits per frame ('reorder_rev')
+	const int N; // number of LLRs per frame ('reorder')
+
+public:
+	Reorderer(const int K, const int N, const int n_frames);
+	virtual ~Reorderer() = default;
+
+	int get_K() const;
+	int get_N() const;
+
+	void reorder    (const Q *Y_N1, Q *Y_N2) const;
+	void reorder_rev(const B *V_K1, B *V_K2) const;
+};
+}
+}
+
+#include "Module/Reorderer/Reorderer.hxx"
+
+#endif /* REORDERER_HPP_ */
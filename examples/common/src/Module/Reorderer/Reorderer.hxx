@@ -0,0 +1,28 @@
+#include "Module/Reorderer/Reorderer.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename Q>
+Task& Reorderer<B,Q>
+::operator[](const rdr::tsk t)
+{
+	return Module::operator[]((int)t);
+}
+
+template <typename B, typename Q>
+Socket& Reorderer<B,Q>
+::operator[](const rdr::sck::reorder s)
+{
+	return Module::operator[]((int)rdr::tsk::reorder)[(int)s];
+}
+
+template <typename B, typename Q>
+Socket& Reorderer<B,Q>
+::operator[](const rdr::sck::reorder_rev s)
+{
+	return Module::operator[]((int)rdr::tsk::reorder_rev)[(int)s];
+}
+}
+}
@@ -0,0 +1,35 @@
+#ifndef SOURCE_RANDOM_STATIC_HPP_
+#define SOURCE_RANDOM_STATIC_HPP_
+
+#include <random>
+#include <array>
+
+#include "Tools/Static/Unroll.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+// compile-time sized version of 'module::Source_random' (same PRNG and distribution). The static modules are not
+// AFF3CT modules (no task, no socket): the chain calls their methods on 'std::array' frames
+template <int K, typename B = int>
+class Source_random_static
+{
+	static_assert(K > 0, "'K' has to be greater than 0.");
+
+protected:
+	std::mt19937                      rd_engine;
+	std::uniform_int_distribution<int> uniform_dist;
+
+public:
+	explicit Source_random_static(const int seed = 0);
+
+	void set_seed(const int seed);
+	void generate(std::array<B,K> &U_K);
+};
+}
+}
+
+#include "Module/Source/Random/Source_random_static.hxx"
+
+#endif /* SOURCE_RANDOM_STATIC_HPP_ */
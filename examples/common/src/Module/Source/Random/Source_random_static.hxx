@@ -0,0 +1,28 @@
+#include "Module/Source/Random/Source_random_static.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <int K, typename B>
+Source_random_static<K,B>
+::Source_random_static(const int seed)
+: rd_engine(seed), uniform_dist(0, 1)
+{
+}
+
+template <int K, typename B>
+void Source_random_static<K,B>
+::set_seed(const int seed)
+{
+	this->rd_engine.seed(seed);
+}
+
+template <int K, typename B>
+void Source_random_static<K,B>
+::generate(std::array<B,K> &U_K)
+{
+	tools::Unroll<0,K>::apply([&](const int i) { U_K[i] = (B)this->uniform_dist(this->rd_engine); });
+}
+}
+}
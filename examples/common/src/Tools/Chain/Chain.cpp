@@ -0,0 +1,343 @@
+#include "Module/Encoder/Repetition/Encoder_repetition_simd.hpp"
+#include "Module/Monitor/BFER/Monitor_BFER_AZCW.hpp"
+#include "Tools/Parameters/Parameters_key.hpp"
+#include "Tools/Socket/Socket_fanout.hpp"
+
+#include "Tools/Chain/Chain.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+// buffer of a socket (the buffer of the output socket it is bound to for an input socket)
+template <typename T>
+inline T* data(module::Socket *s)
+{
+	return static_cast<T*>(s->get_dataptr());
+}
+}
+
+Chain
+::Chain(const parameters &p, std::unique_ptr<module::Monitor_BFER<>> &monitor, const int tid, const bool stats,
+        Chain *reuse)
+: n_tx(0), n_once(0), azcw(p.source->type == "AZCW")
+{
+	// different seeds for different chains (the parameters are shared by the chains: the seeds are changed in copies)
+	std::unique_ptr<factory::Source          ::parameters> src_params(p.source ->clone());
+	std::unique_ptr<factory::Channel_extended::parameters> chn_params(p.channel->clone());
+	src_params->seed += tid;
+	chn_params->seed += tid;
+
+	// a module of 'reuse' is moved in this chain when it was built with the same parameters (e.g. the consecutive jobs
+	// of a sweep): the expensive modules (codec) are not built again
+	auto is_built = [this, reuse](const std::string &name, const std::vector<const factory::Factory::parameters*> &mp)
+	{
+		const auto key   = tools::parameters_key(mp);
+		this->keys[name] = key;
+		if (!reuse)
+			return false;
+		const auto found = reuse->keys.find(name);
+		return found != reuse->keys.end() && found->second == key;
+	};
+
+	const auto new_codec = !is_built("codec", { p.family.get(), p.codec.get() });
+	if (new_codec)
+		this->codec = std::unique_ptr<module::Codec_SIHO<>>(factory::Codec_generic::build(*p.codec));
+	else
+		this->codec = std::move(reuse->codec);
+	if (!is_built("modem", { p.modem.get() }))
+		this->modem = std::unique_ptr<module::Modem<>>(p.modem->build());
+	else
+		this->modem = std::move(reuse->modem);
+	// the reused PRNGs are reseeded to give the same frames as new modules
+	if (!is_built("source", { src_params.get() }))
+		this->source = std::unique_ptr<module::Source<>>(src_params->build());
+	else
+	{
+		this->source = std::move(reuse->source);
+		this->source->set_seed(src_params->seed);
+	}
+	if (!is_built("channel", { chn_params.get() }))
+		this->channel = std::unique_ptr<module::Channel<>>(chn_params->build());
+	else
+	{
+		this->channel = std::move(reuse->channel);
+		this->channel->set_seed(chn_params->seed);
+	}
+
+	// the monitor of an all-zero codeword simulation compares the decoded bits with its own frame of zeros
+	if (this->azcw)
+		monitor = std::unique_ptr<module::Monitor_BFER<>>(new module::Monitor_BFER_AZCW<>(
+			p.monitor->K, p.monitor->n_frame_errors, p.monitor->max_frame, p.monitor->count_unknown_values,
+			p.monitor->n_frames));
+	else
+		monitor = std::unique_ptr<module::Monitor_BFER<>>(p.monitor->build());
+	this->monitor = monitor.get();
+	this->encoder = this->codec->get_encoder().get();
+	this->decoder = this->codec->get_decoder_siho().get();
+	if (p.family->is_reordered())
+		this->reorderer = std::unique_ptr<module::Reorderer<>>(new module::Reorderer<>(p.codec->dec->K,
+		                                                                               p.codec->dec->N_cw,
+		                                                                               p.codec->dec->n_frames));
+
+	this->list = { this->source.get(), this->modem.get(), this->channel.get(), this->monitor, this->encoder,
+	               this->decoder };
+	if (this->reorderer)
+		this->list.push_back(this->reorderer.get());
+
+	// configuration of the module tasks
+	for (auto& mod : this->list)
+		for (auto& tsk : mod->tasks)
+		{
+			tsk->set_autoalloc(true ); // enable the automatic allocation of the data in the tasks
+			tsk->set_autoexec (false); // disable the auto execution mode of the tasks
+			tsk->set_debug    (false); // disable the debug mode
+			tsk->set_stats    (stats); // enable the statistics (or not)
+			tsk->set_fast     (!stats); // disable the useless verifs in the tasks if there is no statistics
+		}
+
+	// reset the memory of the decoder after the end of each communication
+	this->monitor->add_handler_check(std::bind(&module::Decoder::reset, this->decoder));
+
+	// initialize the interleaver if this code use an interleaver
+	if (new_codec)
+	{
+		try
+		{
+			auto& interleaver = this->codec->get_interleaver();
+			interleaver->init();
+		}
+		catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+	}
+
+	// sockets binding and stages
+	using namespace module;
+	// the SIMD repetition encoder modulates the BPSK symbols itself: the 'modulate' task of the modem is not executed
+	auto enc_bpsk = p.modem->type == "BPSK" ? dynamic_cast<module::Encoder_repetition_simd<>*>(this->encoder) : nullptr;
+
+	auto s_U_K = &(*this->source)[src::sck::generate::U_K];
+	this->add_stage(*this->source, (*this->source)[src::tsk::generate], [this, s_U_K]()
+	{
+		this->source->generate(data<int>(s_U_K));
+	});
+
+	auto e_U_K = enc_bpsk ? &(*enc_bpsk)[encr::sck::encode_bpsk::U_K] : &(*this->encoder)[enc::sck::encode::U_K];
+	auto m_U   = &(*this->monitor)[mnt::sck::check_errors::U];
+	if (this->azcw) // the 'U' socket of the monitor is bound to its frame of zeros
+		this->bind(*e_U_K, *s_U_K);
+	else // the encoder and the monitor read the same source buffer
+	{
+		tools::bind_fanout(*s_U_K, { e_U_K, m_U });
+		this->bindings.push_back({ s_U_K, e_U_K });
+		this->bindings.push_back({ s_U_K, m_U   });
+	}
+
+	Socket* symbols; // output of the modulation
+	if (enc_bpsk)
+	{
+		symbols = &(*enc_bpsk)[encr::sck::encode_bpsk::X_N];
+		this->add_stage(*enc_bpsk, (*enc_bpsk)[encr::tsk::encode_bpsk], [enc_bpsk, e_U_K, symbols]()
+		{
+			enc_bpsk->encode_bpsk(data<int>(e_U_K), data<float>(symbols));
+		});
+	}
+	else
+	{
+		auto e_X_N = &(*this->encoder)[enc::sck::encode  ::X_N ];
+		auto m_X_N = &(*this->modem  )[mdm::sck::modulate::X_N1];
+		symbols    = &(*this->modem  )[mdm::sck::modulate::X_N2];
+		this->bind(*m_X_N, *e_X_N);
+		this->add_stage(*this->encoder, (*this->encoder)[enc::tsk::encode], [this, e_U_K, e_X_N]()
+		{
+			this->encoder->encode(data<int>(e_U_K), data<int>(e_X_N));
+		});
+		this->add_stage(*this->modem, (*this->modem)[mdm::tsk::modulate], [this, m_X_N, symbols]()
+		{
+			this->modem->modulate(data<int>(m_X_N), data<float>(symbols));
+		});
+	}
+
+	// the all-zero codeword is generated, encoded and modulated once: the modulated frame does not change
+	if (this->azcw)
+		this->n_once = this->stages.size();
+
+	Socket* llrs; // output of the demodulator
+	if (p.channel->has_gains()) // the demodulator reads the gains in the output socket of the channel (no copy)
+	{
+		auto c_X_N = &(*this->channel)[chn::sck::add_noise_wg ::X_N ];
+		auto c_H_N = &(*this->channel)[chn::sck::add_noise_wg ::H_N ];
+		auto c_Y_N = &(*this->channel)[chn::sck::add_noise_wg ::Y_N ];
+		auto d_H_N = &(*this->modem  )[mdm::sck::demodulate_wg::H_N ];
+		auto d_Y_N = &(*this->modem  )[mdm::sck::demodulate_wg::Y_N1];
+		llrs       = &(*this->modem  )[mdm::sck::demodulate_wg::Y_N2];
+		this->bind(*c_X_N, *symbols);
+		this->bind(*d_H_N, *c_H_N  );
+		this->bind(*d_Y_N, *c_Y_N  );
+		this->add_stage(*this->channel, (*this->channel)[chn::tsk::add_noise_wg], [this, c_X_N, c_H_N, c_Y_N]()
+		{
+			this->channel->add_noise_wg(data<float>(c_X_N), data<float>(c_H_N), data<float>(c_Y_N));
+		});
+		this->n_tx = this->stages.size();
+		this->add_stage(*this->modem, (*this->modem)[mdm::tsk::demodulate_wg], [this, d_H_N, d_Y_N, llrs]()
+		{
+			this->modem->demodulate_wg(data<float>(d_H_N), data<float>(d_Y_N), data<float>(llrs));
+		});
+	}
+	else
+	{
+		auto c_X_N = &(*this->channel)[chn::sck::add_noise ::X_N ];
+		auto c_Y_N = &(*this->channel)[chn::sck::add_noise ::Y_N ];
+		auto d_Y_N = &(*this->modem  )[mdm::sck::demodulate::Y_N1];
+		llrs       = &(*this->modem  )[mdm::sck::demodulate::Y_N2];
+		this->bind(*c_X_N, *symbols);
+		this->bind(*d_Y_N, *c_Y_N  );
+		this->add_stage(*this->channel, (*this->channel)[chn::tsk::add_noise], [this, c_X_N, c_Y_N]()
+		{
+			this->channel->add_noise(data<float>(c_X_N), data<float>(c_Y_N));
+		});
+		this->n_tx = this->stages.size();
+		this->add_stage(*this->modem, (*this->modem)[mdm::tsk::demodulate], [this, d_Y_N, llrs]()
+		{
+			this->modem->demodulate(data<float>(d_Y_N), data<float>(llrs));
+		});
+	}
+
+	auto d_Y_N = &(*this->decoder)[dec::sck::decode_siho ::Y_N];
+	auto d_V_K = &(*this->decoder)[dec::sck::decode_siho ::V_K];
+	auto m_V   = &(*this->monitor)[mnt::sck::check_errors::V  ];
+	if (this->reorderer) // the inter-frame decoder works on interleaved frames
+	{
+		auto r_Y_N1 = &(*this->reorderer)[rdr::sck::reorder    ::Y_N1];
+		auto r_Y_N2 = &(*this->reorderer)[rdr::sck::reorder    ::Y_N2];
+		auto r_V_K1 = &(*this->reorderer)[rdr::sck::reorder_rev::V_K1];
+		auto r_V_K2 = &(*this->reorderer)[rdr::sck::reorder_rev::V_K2];
+		this->bind(*r_Y_N1, *llrs  );
+		this->bind(*d_Y_N,  *r_Y_N2);
+		this->bind(*r_V_K1, *d_V_K );
+		this->bind(*m_V,    *r_V_K2);
+		this->add_stage(*this->reorderer, (*this->reorderer)[rdr::tsk::reorder], [this, r_Y_N1, r_Y_N2]()
+		{
+			this->reorderer->reorder(data<float>(r_Y_N1), data<float>(r_Y_N2));
+		});
+		this->add_stage(*this->decoder, (*this->decoder)[dec::tsk::decode_siho], [this, d_Y_N, d_V_K]()
+		{
+			this->decoder->decode_siho(data<float>(d_Y_N), data<int>(d_V_K));
+		});
+		this->add_stage(*this->reorderer, (*this->reorderer)[rdr::tsk::reorder_rev], [this, r_V_K1, r_V_K2]()
+		{
+			this->reorderer->reorder_rev(data<int>(r_V_K1), data<int>(r_V_K2));
+		});
+	}
+	else
+	{
+		this->bind(*d_Y_N, *llrs );
+		this->bind(*m_V,   *d_V_K);
+		this->add_stage(*this->decoder, (*this->decoder)[dec::tsk::decode_siho], [this, d_Y_N, d_V_K]()
+		{
+			this->decoder->decode_siho(data<float>(d_Y_N), data<int>(d_V_K));
+		});
+	}
+
+	this->add_stage(*this->monitor, (*this->monitor)[mnt::tsk::check_errors], [this, m_U, m_V]()
+	{
+		this->monitor->check_errors(data<int>(m_U), data<int>(m_V));
+	});
+}
+
+void Chain
+::bind(module::Socket &in, module::Socket &out)
+{
+	in.bind(out);
+	this->bindings.push_back({ &out, &in });
+}
+
+void Chain
+::add_stage(module::Module &mod, module::Task &task, const std::function<void()> &call)
+{
+	this->stages.push_back({ mod.get_short_name() + "::" + task.get_name(), &mod, &task, call });
+}
+
+void Chain
+::set_noise(const tools::Sigma<> &noise)
+{
+	this->codec  ->set_noise(noise);
+	this->modem  ->set_noise(noise);
+	this->channel->set_noise(noise);
+}
+
+void Chain
+::set_seeds(const int seed_source, const int seed_channel)
+{
+	this->source ->set_seed(seed_source );
+	this->channel->set_seed(seed_channel);
+}
+
+void Chain
+::exec()
+{
+	for (auto &s : this->stages)
+		s.task->exec();
+}
+
+void Chain
+::exec_once()
+{
+	for (size_t s = 0; s < this->n_once; s++)
+		this->stages[s].task->exec();
+}
+
+void Chain
+::exec_loop()
+{
+	for (size_t s = this->n_once; s < this->stages.size(); s++)
+		this->stages[s].task->exec();
+}
+
+const std::vector<Chain::stage>& Chain
+::get_stages() const
+{
+	return this->stages;
+}
+
+const std::vector<Chain::binding>& Chain
+::get_bindings() const
+{
+	return this->bindings;
+}
+
+const std::vector<module::Module*>& Chain
+::get_modules() const
+{
+	return this->list;
+}
+
+size_t Chain
+::get_n_tx_stages() const
+{
+	return this->n_tx;
+}
+
+size_t Chain
+::get_n_once_stages() const
+{
+	return this->n_once;
+}
+
+bool Chain
+::is_azcw() const
+{
+	return this->azcw;
+}
+
+module::Monitor_BFER<>& Chain
+::get_monitor() const
+{
+	return *this->monitor;
+}
+
+module::Channel<>& Chain
+::get_channel() const
+{
+	return *this->channel;
+}
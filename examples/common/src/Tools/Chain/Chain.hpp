@@ -0,0 +1,109 @@
+#ifndef CHAIN_HPP_
+#define CHAIN_HPP_
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <string>
+#include <map>
+
+#include <aff3ct.hpp>
+
+#include "Factory/Channel/Channel_extended.hpp"
+#include "Factory/Codec_generic/Codec_generic.hpp"
+#include "Factory/Modem/Modem_extended.hpp"
+#include "Module/Reorderer/Reorderer.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// the simulation chain of the examples (source, codec, modem, channel and monitor) built from the parameters of the
+// factories. The sockets are bound once, the examples execute the same stages: as tasks ('Task::exec') or as direct
+// calls to the processing methods of the modules on the buffers of the sockets. With the all-zero codeword source
+// ('AZCW'), the stages of the transmitter before the channel give the same frame at each call: they are executed once
+// per SNR point ('exec_once') and not in the simulation loop ('exec_loop')
+class Chain
+{
+public:
+	struct parameters
+	{
+		std::unique_ptr<factory::Source          ::parameters> source;
+		std::unique_ptr<factory::Codec_generic   ::parameters> family; // codec family (fast decoder selection)
+		std::unique_ptr<factory::Codec_SIHO      ::parameters> codec;
+		std::unique_ptr<factory::Modem_extended  ::parameters> modem;
+		std::unique_ptr<factory::Channel_extended::parameters> channel;
+		std::unique_ptr<factory::Monitor_BFER    ::parameters> monitor;
+	};
+
+	struct stage
+	{
+		std::string           name;   // "module::task"
+		module::Module       *module;
+		module::Task         *task;
+		std::function<void()> call;   // processing method of the module on the buffers of the sockets of 'task'
+	};
+
+	struct binding
+	{
+		module::Socket *out; // output socket of a task
+		module::Socket *in;  // input socket of a next task, bound to 'out'
+	};
+
+protected:
+	std::unique_ptr<module::Source<>>       source;
+	std::unique_ptr<module::Codec_SIHO<>>   codec;
+	std::unique_ptr<module::Modem<>>        modem;
+	std::unique_ptr<module::Channel<>>      channel;
+	std::unique_ptr<module::Reorderer<>>    reorderer; // interleave the frames for the inter-frame decoder
+	                module::Monitor_BFER<>* monitor;   // owned by the caller
+	                module::Encoder<>*      encoder;
+	                module::Decoder_SIHO<>* decoder;
+	std::vector<module::Module*>            list;      // list of the modules of the chain
+	std::vector<stage>                      stages;    // in the order of the chain
+	std::vector<binding>                    bindings;
+	size_t                                  n_tx;      // number of stages of the transmitter (to the channel)
+	size_t                                  n_once;    // number of first stages out of the simulation loop (AZCW)
+	bool                                    azcw;      // all-zero codeword (the monitor has its own frame of zeros)
+	std::map<std::string, std::string>      keys;      // parameters of the built modules (to reuse them)
+
+public:
+	// the monitor is built in 'monitor' (the caller can reduce the monitors of several chains), 'tid' is added to the
+	// seeds of the PRNGs, 'stats' enables the statistics of the tasks (otherwise the tasks are in fast mode). The
+	// modules of 'reuse' that were built with the same parameters are moved in this chain instead of being built again
+	// (their PRNGs are reseeded), 'reuse' can not be executed any more
+	Chain(const parameters &p, std::unique_ptr<module::Monitor_BFER<>> &monitor, const int tid = 0,
+	      const bool stats = true, Chain *reuse = nullptr);
+	virtual ~Chain() = default;
+
+	void set_noise(const Sigma<> &noise);
+
+	// reseed the PRNGs of the source and of the channel ('tid' is not added)
+	void set_seeds(const int seed_source, const int seed_channel);
+
+	// execute the tasks of all the stages once
+	void exec();
+
+	// execute the tasks of the stages out of the simulation loop (after each change of the noise or of the seeds)
+	void exec_once();
+
+	// execute the tasks of the stages of the simulation loop once (all the stages without AZCW)
+	void exec_loop();
+
+	const std::vector<stage>&           get_stages       () const;
+	const std::vector<binding>&         get_bindings     () const;
+	const std::vector<module::Module*>& get_modules      () const;
+	size_t                              get_n_tx_stages  () const;
+	size_t                              get_n_once_stages() const;
+	bool                                is_azcw          () const;
+	module::Monitor_BFER<>&             get_monitor      () const;
+	module::Channel<>&                  get_channel      () const;
+
+protected:
+	void bind     (module::Socket &in, module::Socket &out);
+	void add_stage(module::Module &mod, module::Task &task, const std::function<void()> &call);
+};
+}
+}
+
+#endif /* CHAIN_HPP_ */
@@ -0,0 +1,162 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Checkpoint/Checkpointer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const char     magic[8] = {'A','F','F','3','C','K','P','T'};
+static const uint32_t format   = 1;
+
+Checkpointer
+::Checkpointer(const std::string &path, const std::chrono::milliseconds period)
+: path(path),
+  period(period),
+  t_last(clock::now()),
+  pending(),
+  has_pending(false),
+  writing(false),
+  stop(false)
+{
+	if (path.empty())
+	{
+		std::stringstream message;
+		message << "'path' should not be empty.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (period.count() <= 0)
+	{
+		std::stringstream message;
+		message << "'period' has to be greater than 0 ('period' = " << period.count() << " ms).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->writer = std::thread(&Checkpointer::write_loop, this);
+}
+
+Checkpointer
+::~Checkpointer()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->stop = true;
+	}
+	this->cv.notify_all();
+	this->writer.join(); // the pending state is written before the thread ends
+}
+
+bool Checkpointer
+::load(const uint64_t key, State &state) const
+{
+	std::ifstream file(this->path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	char     m[8];
+	uint32_t f;
+	State    s;
+	file.read(m, sizeof(m));
+	file.read(reinterpret_cast<char*>(&f), sizeof(f));
+	file.read(reinterpret_cast<char*>(&s), sizeof(s));
+
+	if (!file || std::memcmp(m, magic, sizeof(magic)) || f != format)
+	{
+		std::stringstream message;
+		message << "The checkpoint file is corrupted or has an unknown format ('path' = " << this->path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (s.key != key)
+	{
+		std::stringstream message;
+		message << "The checkpoint comes from a simulation with other parameters ('path' = " << this->path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	state = s;
+	return true;
+}
+
+void Checkpointer
+::save(const State &state)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->pending     = state; // a state that is not written yet is replaced by the newer one
+		this->has_pending = true;
+	}
+	this->cv.notify_all();
+	this->t_last = clock::now();
+}
+
+void Checkpointer
+::flush()
+{
+	std::unique_lock<std::mutex> lock(this->mtx);
+	this->cv.wait(lock, [this]() { return !this->has_pending && !this->writing; });
+}
+
+int Checkpointer
+::make_seed(const int seed, const uint32_t snr_idx, const uint32_t epoch)
+{
+	// splitmix64 finalizer: close inputs give uncorrelated seeds
+	uint64_t z = ((uint64_t)(uint32_t)seed << 32) ^ ((uint64_t)snr_idx << 20) ^ (uint64_t)epoch;
+	z += 0x9e3779b97f4a7c15ull;
+	z  = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+	z  = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+	z ^= (z >> 31);
+	return (int)(z & 0x7fffffff);
+}
+
+void Checkpointer
+::write_loop()
+{
+	std::unique_lock<std::mutex> lock(this->mtx);
+	while (true)
+	{
+		this->cv.wait(lock, [this]() { return this->has_pending || this->stop; });
+		if (!this->has_pending && this->stop)
+			break;
+
+		const auto state  = this->pending;
+		this->has_pending = false;
+		this->writing     = true;
+
+		lock.unlock();
+		this->write(state);
+		lock.lock();
+
+		this->writing = false;
+		this->cv.notify_all();
+	}
+}
+
+void Checkpointer
+::write(const State &state) const
+{
+	const auto tmp = this->path + ".tmp";
+	{
+		std::ofstream file(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+		file.write(magic, sizeof(magic));
+		file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+		file.write(reinterpret_cast<const char*>(&state),  sizeof(state ));
+		if (!file)
+		{
+			std::cerr << "(WW) Impossible to write the checkpoint ('tmp' = " << tmp << ")." << std::endl;
+			return;
+		}
+	}
+	// 'rename' atomically replaces the previous checkpoint on POSIX systems but fails on Windows if it exists
+	if (std::rename(tmp.c_str(), this->path.c_str()) != 0)
+	{
+		std::remove(this->path.c_str());
+		std::rename(tmp.c_str(), this->path.c_str());
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef CHECKPOINTER_HPP_
+#define CHECKPOINTER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <mutex>
+
+namespace aff3ct
+{
+namespace tools
+{
+// periodic checkpoints of a simulation in a compact binary file. The PRNG engines of the modules are not serialized:
+// the simulation is split in epochs and the PRNGs are reseeded at the beginning of each epoch from (seed, SNR index,
+// epoch), so resuming after the epoch 'e' is the same as running the epoch 'e+1' without interruption. The worker only
+// copies the state (a few dozen bytes), the file is written by a background thread (temporary file + rename, a crash
+// during the write keeps the previous checkpoint).
+class Checkpointer
+{
+public:
+	struct State
+	{
+		uint64_t key;     // hash of the simulation parameters (see 'Result_store::make_key')
+		uint32_t snr_idx; // index of the current SNR point
+		uint32_t epoch;   // number of checkpoints of the current SNR point
+		uint64_t n_fra;   // monitor counters at the end of the epoch
+		uint64_t n_be;
+		uint64_t n_fe;
+		double   time;    // simulation time of the current SNR point (in seconds)
+	};
+
+protected:
+	using clock = std::chrono::steady_clock;
+
+	const std::string               path;
+	const std::chrono::milliseconds period;
+	clock::time_point               t_last;
+
+	std::thread                     writer;
+	std::mutex                      mtx;
+	std::condition_variable         cv;
+	State                           pending;
+	bool                            has_pending;
+	bool                            writing;
+	bool                            stop;
+
+public:
+	Checkpointer(const std::string &path, const std::chrono::milliseconds period);
+	virtual ~Checkpointer();
+
+	// read the checkpoint file, return false if there is no checkpoint (throw if it does not match 'key')
+	bool load(const uint64_t key, State &state) const;
+
+	// true when the last checkpoint is older than the period
+	inline bool is_due() const;
+
+	// give a copy of the state to the writer thread and return immediately
+	void save(const State &state);
+
+	// wait until the last saved state is in the file
+	void flush();
+
+	// seed of a PRNG for an epoch of an SNR point
+	static int make_seed(const int seed, const uint32_t snr_idx, const uint32_t epoch);
+
+protected:
+	void write_loop();
+	void write(const State &state) const;
+};
+}
+}
+
+#include "Tools/Checkpoint/Checkpointer.hxx"
+
+#endif /* CHECKPOINTER_HPP_ */
@@ -0,0 +1,13 @@
+#include "Tools/Checkpoint/Checkpointer.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+bool Checkpointer
+::is_due() const
+{
+	return clock::now() - this->t_last >= this->period;
+}
+}
+}
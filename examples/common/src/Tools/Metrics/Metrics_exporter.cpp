@@ -0,0 +1,311 @@
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <poll.h>
+#endif
+
+#include <aff3ct.hpp>
+
+#include "Tools/Metrics/Metrics_exporter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Metrics_exporter
+::Metrics_exporter(const std::string &address, const std::vector<const Monitor_snapshot*> &snapshots, const int K,
+                   const Stats_reduction *stats)
+: snapshots(snapshots),
+  K(K),
+  stats(stats),
+  ebn0(0.f),
+  stop(false),
+  listen_fd(-1),
+  prev_threads_time(stats ? stats->get_n_threads() : 0, 0),
+  t_prev(clock::now())
+{
+	if (snapshots.empty())
+	{
+		std::stringstream message;
+		message << "'snapshots' should not be empty.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->listen_fd = Metrics_exporter::listen(address, this->unix_path);
+	this->server = std::thread(&Metrics_exporter::serve_loop, this);
+}
+
+Metrics_exporter
+::~Metrics_exporter()
+{
+	this->stop = true;
+	if (this->server.joinable())
+		this->server.join();
+#ifndef _WIN32
+	::close(this->listen_fd);
+	if (!this->unix_path.empty())
+		::unlink(this->unix_path.c_str());
+#endif
+}
+
+void Metrics_exporter
+::set_ebn0(const float ebn0)
+{
+	this->ebn0 = ebn0;
+}
+
+std::string Metrics_exporter
+::get_metrics()
+{
+	std::stringstream m;
+	m << std::setprecision(10);
+
+	auto header = [&m](const std::string &name, const std::string &type, const std::string &help)
+	{
+		m << "# HELP " << name << " " << help << "\n";
+		m << "# TYPE " << name << " " << type << "\n";
+	};
+
+	std::vector<Monitor_snapshot::Counters> counters, totals;
+	Monitor_snapshot::Counters sum = {0, 0, 0};
+	for (auto s : this->snapshots)
+	{
+		totals  .push_back(s->read_total());
+		counters.push_back(s->read());
+		sum.n_fra += counters.back().n_fra;
+		sum.n_be  += counters.back().n_be;
+		sum.n_fe  += counters.back().n_fe;
+	}
+	const auto elapsed = this->snapshots.front()->get_elapsed();
+
+	header("aff3ct_ebn0_db", "gauge", "Eb/N0 of the current SNR point (dB).");
+	m << "aff3ct_ebn0_db " << this->ebn0.load() << "\n";
+
+	// the counters of the monitors restart from zero at each SNR point: they are gauges, the Prometheus counters are
+	// the sums over all the SNR points (monotonic, for 'rate()' and 'increase()')
+	const std::string names[3] = {"aff3ct_frames", "aff3ct_bit_errors", "aff3ct_frame_errors"};
+	const std::string helps[3] = {"Simulated frames", "Bit errors", "Frame errors"};
+	for (auto c = 0; c < 3; c++)
+	{
+		header(names[c], "gauge", helps[c] + " of the current SNR point, per thread.");
+		for (size_t t = 0; t < counters.size(); t++)
+		{
+			const auto v = c == 0 ? counters[t].n_fra : c == 1 ? counters[t].n_be : counters[t].n_fe;
+			m << names[c] << "{thread=\"" << t << "\"} " << v << "\n";
+		}
+
+		header(names[c] + "_total", "counter", helps[c] + " of all the SNR points, per thread.");
+		for (size_t t = 0; t < totals.size(); t++)
+		{
+			const auto v = c == 0 ? totals[t].n_fra : c == 1 ? totals[t].n_be : totals[t].n_fe;
+			m << names[c] << "_total{thread=\"" << t << "\"} " << v << "\n";
+		}
+	}
+
+	header("aff3ct_ber", "gauge", "Bit error rate of the current SNR point.");
+	m << "aff3ct_ber " << (sum.n_fra ? (double)sum.n_be / ((double)sum.n_fra * (double)this->K) : 0.) << "\n";
+	header("aff3ct_fer", "gauge", "Frame error rate of the current SNR point.");
+	m << "aff3ct_fer " << (sum.n_fra ? (double)sum.n_fe / (double)sum.n_fra : 0.) << "\n";
+	header("aff3ct_throughput_mbps", "gauge", "Simulation throughput of the current SNR point (Mb/s).");
+	m << "aff3ct_throughput_mbps "
+	  << (elapsed > 0. ? (double)sum.n_fra * (double)this->K / elapsed * 1e-6 : 0.) << "\n";
+	header("aff3ct_elapsed_seconds", "gauge", "Elapsed time of the current SNR point (s).");
+	m << "aff3ct_elapsed_seconds " << elapsed << "\n";
+
+	if (this->stats == nullptr)
+		return m.str();
+
+	// the statistics of the tasks are collected periodically by the threads
+	header("aff3ct_task_calls_total", "counter", "Calls of the task, summed over the threads.");
+	for (size_t r = 0; r < this->stats->get_n_tasks(); r++)
+		m << "aff3ct_task_calls_total{module=\"" << this->stats->get_module_name(r) << "\",task=\""
+		  << this->stats->get_task_name(r) << "\"} " << this->stats->get_n_calls(r) << "\n";
+
+	header("aff3ct_task_seconds_total", "counter", "Time spent in the task, summed over the threads (s).");
+	for (size_t r = 0; r < this->stats->get_n_tasks(); r++)
+		m << "aff3ct_task_seconds_total{module=\"" << this->stats->get_module_name(r) << "\",task=\""
+		  << this->stats->get_task_name(r) << "\"} " << (double)this->stats->get_time(r) * 1e-9 << "\n";
+
+	header("aff3ct_thread_busy_seconds_total", "counter", "Time spent in the tasks by the thread (s).");
+	for (size_t t = 0; t < this->stats->get_n_threads(); t++)
+		m << "aff3ct_thread_busy_seconds_total{thread=\"" << t << "\"} "
+		  << (double)this->stats->get_thread_time(t) * 1e-9 << "\n";
+
+	// fraction of the time spent in the tasks since the previous request
+	const auto t_now  = clock::now();
+	const auto period = std::chrono::duration<double>(t_now - this->t_prev).count();
+	header("aff3ct_thread_utilization", "gauge", "Fraction of the time spent in the tasks since the previous scrape.");
+	for (size_t t = 0; t < this->stats->get_n_threads(); t++)
+	{
+		const auto busy = this->stats->get_thread_time(t);
+		const auto diff = busy >= this->prev_threads_time[t] ? busy - this->prev_threads_time[t] : busy;
+		m << "aff3ct_thread_utilization{thread=\"" << t << "\"} "
+		  << (period > 0. ? (double)diff * 1e-9 / period : 0.) << "\n";
+		this->prev_threads_time[t] = busy;
+	}
+	this->t_prev = t_now;
+
+	return m.str();
+}
+
+void Metrics_exporter
+::serve_loop()
+{
+#ifndef _WIN32
+	while (!this->stop)
+	{
+		// wake up regularly to check if the exporter is destroyed
+		pollfd pfd = {this->listen_fd, POLLIN, 0};
+		if (::poll(&pfd, 1, 200) <= 0)
+			continue;
+
+		const auto fd = ::accept(this->listen_fd, nullptr, nullptr);
+		if (fd < 0)
+			continue;
+
+		this->serve(fd);
+		::close(fd);
+	}
+#endif
+}
+
+void Metrics_exporter
+::serve(const int fd)
+{
+#ifndef _WIN32
+	// a client that does not send its request does not block the exporter for long
+	timeval timeout = {1, 0};
+	::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+#ifdef SO_NOSIGPIPE
+	const int one = 1;
+	::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+
+	// the request is ignored (any path returns the metrics), read it until the end of the headers
+	std::string request;
+	char buffer[1024];
+	while (request.find("\r\n\r\n") == std::string::npos && request.find("\n\n") == std::string::npos &&
+	       request.size() < 8192)
+	{
+		const auto n = ::recv(fd, buffer, sizeof(buffer), 0);
+		if (n <= 0)
+			break;
+		request.append(buffer, (size_t)n);
+	}
+
+	const auto body = this->get_metrics();
+	std::stringstream response;
+	response << "HTTP/1.0 200 OK\r\n"
+	         << "Content-Type: text/plain; version=0.0.4\r\n"
+	         << "Content-Length: " << body.size() << "\r\n"
+	         << "Connection: close\r\n"
+	         << "\r\n"
+	         << body;
+
+#ifdef MSG_NOSIGNAL
+	const int flags = MSG_NOSIGNAL;
+#else
+	const int flags = 0;
+#endif
+	const auto data = response.str();
+	size_t sent = 0;
+	while (sent < data.size())
+	{
+		const auto n = ::send(fd, data.data() + sent, data.size() - sent, flags);
+		if (n <= 0)
+			break;
+		sent += (size_t)n;
+	}
+#endif
+}
+
+int Metrics_exporter
+::listen(const std::string &address, std::string &unix_path)
+{
+#ifdef _WIN32
+	std::stringstream message;
+	message << "The metrics exporter is not available on Windows ('address' = " << address << ").";
+	throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+#else
+	int fd = -1;
+	if (address.compare(0, 5, "unix:") == 0)
+	{
+		const auto path = address.substr(5);
+		sockaddr_un addr;
+		std::memset(&addr, 0, sizeof(addr));
+		if (path.empty() || path.size() >= sizeof(addr.sun_path))
+		{
+			std::stringstream message;
+			message << "The path of the Unix socket is empty or too long ('address' = " << address << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+		addr.sun_family = AF_UNIX;
+		std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) -1);
+
+		// a socket left by a previous run is replaced (but not a regular file)
+		struct stat st;
+		if (::stat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+			::unlink(path.c_str());
+
+		fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		if (fd >= 0 && (::bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(fd, 8) != 0))
+		{
+			::close(fd);
+			fd = -1;
+		}
+		if (fd >= 0)
+			unix_path = path;
+	}
+	else if (address.compare(0, 4, "tcp:") == 0)
+	{
+		const auto port = std::atoi(address.c_str() + 4);
+		if (port <= 0 || port > 65535)
+		{
+			std::stringstream message;
+			message << "The TCP port has to be in [1;65535] ('address' = " << address << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// localhost only: the metrics are not published on the network
+		sockaddr_in addr;
+		std::memset(&addr, 0, sizeof(addr));
+		addr.sin_family      = AF_INET;
+		addr.sin_port        = htons((uint16_t)port);
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		fd = ::socket(AF_INET, SOCK_STREAM, 0);
+		const int one = 1;
+		if (fd >= 0)
+			::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+		if (fd >= 0 && (::bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(fd, 8) != 0))
+		{
+			::close(fd);
+			fd = -1;
+		}
+	}
+	else
+	{
+		std::stringstream message;
+		message << "The address has to be 'unix:PATH' or 'tcp:PORT' ('address' = " << address << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (fd < 0)
+	{
+		std::stringstream message;
+		message << "The metrics exporter cannot listen on '" << address << "' (" << std::strerror(errno) << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return fd;
+#endif
+}
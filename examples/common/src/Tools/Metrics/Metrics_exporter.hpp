@@ -0,0 +1,61 @@
+#ifndef METRICS_EXPORTER_HPP_
+#define METRICS_EXPORTER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Tools/Stats/Stats_reduction.hpp"
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// background thread that serves the live metrics of the simulation in the Prometheus text format (HTTP, any path)
+// over a Unix domain socket ("unix:PATH") or a localhost TCP port ("tcp:PORT"). The metrics are read from the snapshots
+// of the monitors and from the totals of the 'Stats_reduction' (atomics): the worker threads are never locked.
+// POSIX only.
+class Metrics_exporter
+{
+protected:
+	using clock = std::chrono::steady_clock;
+
+	const std::vector<const Monitor_snapshot*> snapshots; // one per thread
+	const int                                  K;         // number of information bits per frame
+	const Stats_reduction                     *stats;     // statistics of the tasks (can be null)
+
+	std::atomic<float>   ebn0;
+	std::atomic<bool>    stop;
+	int                  listen_fd;
+	std::string          unix_path; // removed at the destruction (empty for TCP)
+	std::thread          server;
+
+	// busy time of the threads at the previous request, for the utilization (only used by the server thread)
+	std::vector<int64_t> prev_threads_time;
+	clock::time_point    t_prev;
+
+public:
+	Metrics_exporter(const std::string &address, const std::vector<const Monitor_snapshot*> &snapshots, const int K,
+	                 const Stats_reduction *stats = nullptr);
+	virtual ~Metrics_exporter();
+
+	// SNR of the current point, set by the simulation between two SNR points
+	void set_ebn0(const float ebn0);
+
+	// current metrics in the Prometheus text format
+	std::string get_metrics();
+
+protected:
+	void serve_loop();
+	void serve(const int fd);
+
+	static int listen(const std::string &address, std::string &unix_path);
+};
+}
+}
+
+#endif /* METRICS_EXPORTER_HPP_ */
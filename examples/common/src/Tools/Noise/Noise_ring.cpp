@@ -0,0 +1,140 @@
+#include <sstream>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Noise/Noise_ring.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename R>
+Noise_ring<R>
+::Noise_ring(const size_t block_size, const size_t n_blocks, const size_t n_producers, const int seed)
+: block_size(block_size),
+  n_blocks(n_blocks),
+  n_producers(n_producers),
+  data(n_producers * n_blocks * block_size),
+  rings(n_producers),
+  stop(false),
+  cur(0),
+  n_stalls(0)
+{
+	if (block_size == 0)
+	{
+		std::stringstream message;
+		message << "'block_size' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_blocks < 2)
+	{
+		std::stringstream message;
+		message << "'n_blocks' has to be greater than 1 ('n_blocks' = " << n_blocks << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_producers == 0)
+	{
+		std::stringstream message;
+		message << "'n_producers' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->start(seed);
+}
+
+template <typename R>
+Noise_ring<R>
+::~Noise_ring()
+{
+	this->halt();
+}
+
+template <typename R>
+void Noise_ring<R>
+::reset(const int seed)
+{
+	this->halt();
+	this->start(seed);
+}
+
+template <typename R>
+size_t Noise_ring<R>
+::get_block_size() const
+{
+	return this->block_size;
+}
+
+template <typename R>
+uint64_t Noise_ring<R>
+::get_n_stalls() const
+{
+	return this->n_stalls;
+}
+
+template <typename R>
+void Noise_ring<R>
+::start(const int seed)
+{
+	for (auto &r : this->rings)
+	{
+		r.head             = 0;
+		r.tail             = 0;
+		r.consumer_waiting = false;
+		r.producer_waiting = false;
+	}
+	this->cur  = 0;
+	this->stop = false;
+
+	for (size_t p = 0; p < this->n_producers; p++)
+		this->producers.push_back(std::thread(&Noise_ring<R>::produce, this, p, seed + (int)(p << 16)));
+}
+
+template <typename R>
+void Noise_ring<R>
+::halt()
+{
+	this->stop = true;
+	for (auto &r : this->rings)
+		Noise_ring<R>::wake(r);
+	for (auto &t : this->producers)
+		t.join();
+	this->producers.clear();
+}
+
+template <typename R>
+void Noise_ring<R>
+::produce(const size_t p, const int seed)
+{
+	tools::Gaussian_noise_generator_fast<R> generator(seed);
+	auto &r = this->rings[p];
+
+	while (!this->stop.load(std::memory_order_relaxed))
+	{
+		const auto tail = r.tail.load(std::memory_order_relaxed);
+		if (tail - r.head.load(std::memory_order_acquire) == this->n_blocks)
+		{
+			// the ring is full: sleep until the consumer releases a block (or until the ring is halted)
+			std::unique_lock<std::mutex> lock(r.mtx);
+			r.producer_waiting = true;
+			r.cv.wait(lock, [this, &r, tail]() { return tail - r.head.load() != this->n_blocks || this->stop.load(); });
+			r.producer_waiting = false;
+			continue;
+		}
+
+		generator.generate(this->get_block(p, tail), (unsigned)this->block_size, (R)1);
+		r.tail.store(tail +1);
+		if (r.consumer_waiting.load())
+			Noise_ring<R>::wake(r);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Noise_ring<R_32>;
+template class aff3ct::tools::Noise_ring<R_64>;
+#else
+template class aff3ct::tools::Noise_ring<R>;
+#endif
+// ==================================================================================== explicit template instantiation
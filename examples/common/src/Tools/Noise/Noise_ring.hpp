@@ -0,0 +1,80 @@
+#ifndef NOISE_RING_HPP_
+#define NOISE_RING_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <mutex>
+
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+// blocks of unit-variance Gaussian noise generated in advance by background threads. Each producer thread owns a
+// single-producer/single-consumer ring (no lock, only acquire/release indices), the consumer takes the blocks from the
+// rings in a round-robin order: the sequence of blocks only depends on the seed, not on the thread scheduling. A side
+// that has to wait (empty or full ring) sleeps on the condition variable of the ring, the lock is only taken then.
+template <typename R = float>
+class Noise_ring
+{
+protected:
+	// indices of a ring, padded to avoid the false sharing between the producer and the consumer
+	struct Ring
+	{
+		std::atomic<uint64_t> head; // next block to read (written by the consumer)
+		char padding1[64 - sizeof(std::atomic<uint64_t>)];
+		std::atomic<uint64_t> tail; // next block to write (written by the producer)
+		char padding2[64 - sizeof(std::atomic<uint64_t>)];
+
+		// slow path: the consumer waits for a block or the producer waits for a free slot
+		std::atomic<bool>       consumer_waiting;
+		std::atomic<bool>       producer_waiting;
+		std::mutex              mtx;
+		std::condition_variable cv;
+	};
+
+	const size_t             block_size;
+	const size_t             n_blocks;    // number of blocks per ring
+	const size_t             n_producers;
+
+	mipp::vector<R>          data;        // n_producers x n_blocks x block_size
+	std::vector<Ring>        rings;
+	std::vector<std::thread> producers;
+	std::atomic<bool>        stop;
+
+	size_t                   cur;         // ring of the next block (consumer only)
+	uint64_t                 n_stalls;    // number of times the consumer waited for a block (consumer only)
+
+public:
+	Noise_ring(const size_t block_size, const size_t n_blocks, const size_t n_producers, const int seed = 0);
+	virtual ~Noise_ring();
+
+	// wait for the next block of noise (does not block if the producers are fast enough)
+	inline const R* acquire();
+
+	// give the block back to its producer (has to be called after each 'acquire')
+	inline void release();
+
+	// stop the producers, drop the generated blocks and start again with a new seed
+	void reset(const int seed);
+
+	size_t   get_block_size() const;
+	uint64_t get_n_stalls  () const;
+
+protected:
+	void start(const int seed);
+	void halt();
+	void produce(const size_t p, const int seed);
+	inline R* get_block(const size_t p, const uint64_t idx);
+	static void wake(Ring &r);
+};
+}
+}
+
+#include "Tools/Noise/Noise_ring.hxx"
+
+#endif /* NOISE_RING_HPP_ */
@@ -0,0 +1,53 @@
+#include "Tools/Noise/Noise_ring.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename R>
+const R* Noise_ring<R>
+::acquire()
+{
+	auto &r = this->rings[this->cur];
+	const auto head = r.head.load(std::memory_order_relaxed);
+	if (r.tail.load(std::memory_order_acquire) == head)
+	{
+		// the producer is late: sleep until it publishes the block (the flag and the index are sequentially
+		// consistent, so the producer sees the flag or the consumer sees the new block)
+		this->n_stalls++;
+		std::unique_lock<std::mutex> lock(r.mtx);
+		r.consumer_waiting = true;
+		r.cv.wait(lock, [&r, head]() { return r.tail.load() != head; });
+		r.consumer_waiting = false;
+	}
+	return this->get_block(this->cur, head);
+}
+
+template <typename R>
+void Noise_ring<R>
+::release()
+{
+	auto &r = this->rings[this->cur];
+	r.head.store(r.head.load(std::memory_order_relaxed) +1);
+	if (r.producer_waiting.load())
+		Noise_ring<R>::wake(r);
+	this->cur = (this->cur +1) % this->n_producers;
+}
+
+template <typename R>
+void Noise_ring<R>
+::wake(Ring &r)
+{
+	// taking the lock guarantees that the waiting side is either before its check or already asleep
+	{ std::lock_guard<std::mutex> lock(r.mtx); }
+	r.cv.notify_all();
+}
+
+template <typename R>
+R* Noise_ring<R>
+::get_block(const size_t p, const uint64_t idx)
+{
+	return this->data.data() + (p * this->n_blocks + (size_t)(idx % this->n_blocks)) * this->block_size;
+}
+}
+}
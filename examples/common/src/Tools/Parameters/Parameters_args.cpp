@@ -0,0 +1,45 @@
+#include <algorithm>
+
+#include "Tools/Parameters/Parameters_args.hpp"
+
+using namespace aff3ct;
+
+// the command line spelling of a tag: "-K" for a one-letter tag, "--src-info-bits" otherwise
+static std::string to_arg(const std::string &tag)
+{
+	return (tag.size() == 1 ? "-" : "--") + tag;
+}
+
+std::vector<std::string> tools::argument_aliases(const std::vector<const factory::Factory::parameters*> &params,
+                                                 const std::string &arg)
+{
+	const auto name = arg.substr(std::min(arg.find_first_not_of('-'), arg.size()));
+
+	std::vector<std::string> aliases = { arg };
+	for (auto p : params)
+	{
+		tools::Argument_map_info args;
+		p->get_description(args);
+
+		for (auto &a : args)
+		{
+			const auto &tag = a.first;
+			if (std::find(tag.begin(), tag.end(), name) == tag.end())
+				continue;
+
+			for (auto &t : tag)
+				if (std::find(aliases.begin(), aliases.end(), to_arg(t)) == aliases.end())
+					aliases.push_back(to_arg(t));
+		}
+	}
+	return aliases;
+}
+
+bool tools::argument_exists(const std::vector<const factory::Factory::parameters*> &params,
+                            const std::vector<std::string> &args, const std::string &arg)
+{
+	for (auto &a : tools::argument_aliases(params, arg))
+		if (std::find(args.begin(), args.end(), a) != args.end())
+			return true;
+	return false;
+}
@@ -0,0 +1,24 @@
+#ifndef PARAMETERS_ARGS_HPP_
+#define PARAMETERS_ARGS_HPP_
+
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// all the spellings of the command line argument 'arg' in the argument maps of 'params' (e.g. "-K" gives "-K",
+// "--src-info-bits", "--enc-info-bits", ...): the aliases of all the tags that contain 'arg', and 'arg' itself
+std::vector<std::string> argument_aliases(const std::vector<const factory::Factory::parameters*> &params,
+                                          const std::string &arg);
+
+// true if one of the spellings of 'arg' in the argument maps of 'params' is in the command line 'args'
+bool argument_exists(const std::vector<const factory::Factory::parameters*> &params,
+                     const std::vector<std::string> &args, const std::string &arg);
+}
+}
+
+#endif /* PARAMETERS_ARGS_HPP_ */
@@ -0,0 +1,29 @@
+#include <sstream>
+#include <map>
+
+#include "Tools/Parameters/Parameters_key.hpp"
+
+using namespace aff3ct;
+
+std::string tools::parameters_key(const std::vector<const factory::Factory::parameters*> &params)
+{
+	// 'std::map' sorts the headers by prefix, the order of the parameters in the list does not matter
+	std::map<std::string,factory::header_list> headers;
+	for (auto p : params)
+		p->get_headers(headers, true);
+
+	std::stringstream key;
+	for (auto &h : headers)
+	{
+		key << h.first << "{";
+		for (auto &kv : h.second)
+			key << kv.first << "=" << kv.second << ";";
+		key << "}";
+	}
+	return key.str();
+}
+
+std::string tools::parameters_key(const factory::Factory::parameters &params)
+{
+	return tools::parameters_key(std::vector<const factory::Factory::parameters*>{&params});
+}
@@ -0,0 +1,20 @@
+#ifndef PARAMETERS_KEY_HPP_
+#define PARAMETERS_KEY_HPP_
+
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// canonical textual representation of a set of parameters (= all their headers sorted by prefix): two sets of
+// parameters that build the same modules have the same key
+std::string parameters_key(const std::vector<const factory::Factory::parameters*> &params);
+std::string parameters_key(const factory::Factory::parameters &params);
+}
+}
+
+#endif /* PARAMETERS_KEY_HPP_ */
@@ -0,0 +1,31 @@
+#include <sstream>
+
+#include "Tools/Socket/Socket_fanout.hpp"
+
+using namespace aff3ct;
+
+void tools::bind_fanout(module::Socket &producer, const std::vector<module::Socket*> &consumers)
+{
+	for (auto consumer : consumers)
+	{
+		if (consumer == nullptr)
+		{
+			std::stringstream message;
+			message << "'consumer' can't be null.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (consumer->get_databytes() != producer.get_databytes())
+		{
+			std::stringstream message;
+			message << "'consumer->get_databytes()' has to be equal to 'producer.get_databytes()' ("
+			        << "'consumer->get_name()' = " << consumer->get_name() << ", "
+			        << "'consumer->get_databytes()' = " << consumer->get_databytes() << ", "
+			        << "'producer.get_name()' = " << producer.get_name() << ", "
+			        << "'producer.get_databytes()' = " << producer.get_databytes() << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		consumer->bind(producer);
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef SOCKET_FANOUT_HPP_
+#define SOCKET_FANOUT_HPP_
+
+#include <vector>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// bind all the 'consumers' input sockets directly to the 'producer' output socket: the consumers read the same buffer
+// (no copy) and, contrary to a binding on an input socket that is itself bound, the result does not depend on the order
+// of the bindings
+void bind_fanout(module::Socket &producer, const std::vector<module::Socket*> &consumers);
+}
+}
+
+#endif /* SOCKET_FANOUT_HPP_ */
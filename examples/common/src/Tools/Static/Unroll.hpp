@@ -0,0 +1,30 @@
+#ifndef UNROLL_HPP_
+#define UNROLL_HPP_
+
+namespace aff3ct
+{
+namespace tools
+{
+// compile-time unrolling of a loop: 'Unroll<0,N>::apply(f)' calls f(0), f(1), ..., f(N-1) without loop, the index is
+// a constant for the compiler once 'f' is inlined (register allocation, no loop counter, no tail)
+template <int I, int N>
+struct Unroll
+{
+	template <class F>
+	static inline void apply(F &&f)
+	{
+		f(I);
+		Unroll<I +1, N>::apply(f);
+	}
+};
+
+template <int N>
+struct Unroll<N,N>
+{
+	template <class F>
+	static inline void apply(F &&) {}
+};
+}
+}
+
+#endif /* UNROLL_HPP_ */
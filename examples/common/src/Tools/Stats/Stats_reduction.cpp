@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
+#include <limits>
+
+#include "Tools/Stats/Stats_reduction.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Stats_reduction
+::Stats_reduction(const std::vector<const module::Module*> &modules, const size_t n_threads)
+: n_threads(n_threads)
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t m = 0; m < modules.size(); m++)
+		for (size_t t = 0; t < modules[m]->tasks.size(); t++)
+		{
+			this->modules_names.push_back(modules[m]->get_short_name());
+			this->tasks_names  .push_back(modules[m]->tasks[t]->get_name());
+			this->tasks_ids    .push_back(std::make_pair(m, t));
+		}
+
+	// each thread writes in its own row, the rows are allocated separately to avoid false sharing
+	this->samples.resize(n_threads);
+	for (auto &s : this->samples)
+		s.resize(this->tasks_ids.size());
+
+	this->total_n_calls = std::vector<std::atomic<uint64_t>>(this->tasks_ids.size());
+	this->total_time    = std::vector<std::atomic<int64_t >>(this->tasks_ids.size());
+	this->threads_time  = std::vector<std::atomic<int64_t >>(n_threads);
+	this->reset();
+}
+
+void Stats_reduction
+::collect(const size_t tid, const std::vector<const module::Module*> &modules)
+{
+	if (tid >= this->n_threads)
+	{
+		std::stringstream message;
+		message << "'tid' has to be smaller than 'n_threads' ('tid' = " << tid << ", 'n_threads' = "
+		        << this->n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto &samples = this->samples[tid];
+	int64_t thread_time = 0;
+	for (size_t r = 0; r < this->tasks_ids.size(); r++)
+	{
+		const auto &task = *modules[this->tasks_ids[r].first]->tasks[this->tasks_ids[r].second];
+
+		const auto n_calls  = task.get_n_calls();
+		const auto duration = task.get_duration_total();
+
+		// the task statistics may have been reset since the last call
+		const auto prev = (n_calls < samples[r].n_calls) ? Task_sample() : samples[r];
+
+		this->total_n_calls[r].fetch_add(n_calls - prev.n_calls, std::memory_order_relaxed);
+		this->total_time   [r].fetch_add((duration - prev.duration).count(), std::memory_order_relaxed);
+		thread_time += (duration - prev.duration).count();
+
+		samples[r].n_calls  = n_calls;
+		samples[r].duration = duration;
+	}
+	this->threads_time[tid].fetch_add(thread_time, std::memory_order_relaxed);
+}
+
+void Stats_reduction
+::show(std::ostream &stream, const bool ordered) const
+{
+	const auto n_rows = this->tasks_ids.size();
+
+	std::vector<size_t> rows(n_rows);
+	std::iota(rows.begin(), rows.end(), 0);
+	if (ordered)
+		std::stable_sort(rows.begin(), rows.end(), [this](const size_t a, const size_t b)
+		{
+			return this->total_time[a].load() > this->total_time[b].load();
+		});
+
+	int64_t total_time_all = 0;
+	for (size_t r = 0; r < n_rows; r++)
+		total_time_all += this->total_time[r].load();
+
+	// widths of the columns, grouped like in the 'tools::Stats' table
+	const std::vector<std::vector<size_t>> widths = {{19, 21}, {8, 8, 6}, {8, 8, 8, 6}};
+
+	auto line = [&widths](const std::vector<std::string> &cells) -> std::string
+	{
+		std::stringstream l;
+		l << "#";
+		size_t c = 0;
+		for (size_t g = 0; g < widths.size(); g++)
+		{
+			if (g) l << "||";
+			for (size_t w = 0; w < widths[g].size(); w++, c++)
+				l << (w ? "|" : "") << " " << std::setw(widths[g][w]) << cells[c] << " ";
+		}
+		return l.str();
+	};
+
+	auto separator = [&widths](const bool groups_only) -> std::string
+	{
+		std::string l = "#";
+		for (size_t g = 0; g < widths.size(); g++)
+		{
+			if (g) l += "||";
+			for (size_t w = 0; w < widths[g].size(); w++)
+				l += (w ? (groups_only ? "-" : "|") : (g ? "" : " ")) + std::string(widths[g][w] + (g || w ? 2 : 1), '-');
+		}
+		return l;
+	};
+
+	auto title = [&widths](const std::vector<std::string> &titles) -> std::string
+	{
+		std::string l = "# ";
+		for (size_t g = 0; g < widths.size(); g++)
+		{
+			size_t width = widths[g].size() - (g ? 1 : 2);
+			for (auto w : widths[g]) width += w + 2;
+
+			const auto &str = titles[g];
+			const auto left  = (width > str.size()) ? (width - str.size()) / 2 : 0;
+			const auto right = (width > str.size() + left) ? width - str.size() - left : 0;
+			l += (g ? "||" : "") + std::string(left, ' ') + str + std::string(right, ' ');
+		}
+		return l;
+	};
+
+	std::stringstream threads;
+	threads << "(aggregated over " << this->n_threads << " threads)";
+
+	stream << separator(true) << std::endl;
+	stream << title({"Statistics for the given task", "Basic statistics", "Per-thread time"            }) << std::endl;
+	stream << title({threads.str(),                   "on the task",      "(skew = (max - min) / mean)"}) << std::endl;
+	stream << separator(true ) << std::endl;
+	stream << separator(false) << std::endl;
+	stream << line({"MODULE", "TASK", "CALLS", "TIME", "PERC", "MEAN", "MINIMUM", "MAXIMUM", "SKEW"}) << std::endl;
+	stream << line({"",       "",     "",      "(s)",  "(%)",  "(s)",  "(s)",     "(s)",     "(%)" }) << std::endl;
+	stream << separator(false) << std::endl;
+
+	for (auto r : rows)
+	{
+		const auto n_calls = this->total_n_calls[r].load();
+		if (n_calls == 0)
+			continue;
+
+		int64_t t_min = std::numeric_limits<int64_t>::max();
+		int64_t t_max = 0;
+		for (size_t t = 0; t < this->n_threads; t++)
+		{
+			const auto d = (int64_t)this->samples[t][r].duration.count();
+			t_min = std::min(t_min, d);
+			t_max = std::max(t_max, d);
+		}
+
+		const auto t_tot  = (double)this->total_time[r].load();
+		const auto t_mean = t_tot / (double)this->n_threads;
+		const auto perc   = total_time_all ? 100. * t_tot / (double)total_time_all : 0.;
+		const auto skew   = t_mean > 0. ? 100. * (double)(t_max - t_min) / t_mean : 0.;
+
+		auto to_str = [](const double v) -> std::string
+		{
+			std::stringstream s;
+			s << std::setprecision(2) << std::fixed << v;
+			return s.str();
+		};
+
+		stream << line({this->modules_names[r],
+		                this->tasks_names[r],
+		                std::to_string(n_calls),
+		                to_str(t_tot * 1e-9),
+		                to_str(perc),
+		                to_str(t_mean * 1e-9),
+		                to_str((double)t_min * 1e-9),
+		                to_str((double)t_max * 1e-9),
+		                to_str(skew)}) << std::endl;
+	}
+	stream << separator(false) << std::endl;
+}
+
+size_t Stats_reduction
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+size_t Stats_reduction
+::get_n_tasks() const
+{
+	return this->tasks_ids.size();
+}
+
+const std::string& Stats_reduction
+::get_module_name(const size_t row) const
+{
+	return this->modules_names[row];
+}
+
+const std::string& Stats_reduction
+::get_task_name(const size_t row) const
+{
+	return this->tasks_names[row];
+}
+
+uint64_t Stats_reduction
+::get_n_calls(const size_t row) const
+{
+	return this->total_n_calls[row].load(std::memory_order_relaxed);
+}
+
+int64_t Stats_reduction
+::get_time(const size_t row) const
+{
+	return this->total_time[row].load(std::memory_order_relaxed);
+}
+
+int64_t Stats_reduction
+::get_thread_time(const size_t tid) const
+{
+	return this->threads_time[tid].load(std::memory_order_relaxed);
+}
+
+void Stats_reduction
+::reset()
+{
+	for (auto &s : this->samples)
+		std::fill(s.begin(), s.end(), Task_sample());
+	for (auto &n : this->total_n_calls) n.store(0);
+	for (auto &t : this->total_time   ) t.store(0);
+	for (auto &t : this->threads_time ) t.store(0);
+}
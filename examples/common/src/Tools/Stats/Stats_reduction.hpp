@@ -0,0 +1,63 @@
+#ifndef STATS_REDUCTION_HPP_
+#define STATS_REDUCTION_HPP_
+
+#include <iostream>
+#include <cstdint>
+#include <utility>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// aggregate the statistics of the same task replicated over several threads: one row per task (and not one row per
+// task and per thread), with the total time, the mean time per thread and the per-thread min/max (= load imbalance)
+class Stats_reduction
+{
+protected:
+	struct Task_sample
+	{
+		uint32_t                 n_calls  = 0;
+		std::chrono::nanoseconds duration = std::chrono::nanoseconds(0);
+	};
+
+	const size_t                             n_threads;
+	std::vector<std::string>                 modules_names; // module short name of each task row
+	std::vector<std::string>                 tasks_names;   // task name of each task row
+	std::vector<std::pair<size_t,size_t>>    tasks_ids;     // (module id, task id) of each row in a thread module list
+	std::vector<std::vector<Task_sample>>    samples;       // last collected values [thread][row]
+	std::vector<std::atomic<uint64_t>>       total_n_calls; // sum of the calls over the threads [row]
+	std::vector<std::atomic<int64_t >>       total_time;    // sum of the durations (in ns) over the threads [row]
+	std::vector<std::atomic<int64_t >>       threads_time;  // sum of the durations (in ns) over the tasks [thread]
+
+public:
+	Stats_reduction(const std::vector<const module::Module*> &modules, const size_t n_threads);
+	virtual ~Stats_reduction() = default;
+
+	// update the row of the thread 'tid' with the current statistics of its modules (the modules have to be given in
+	// the same order as in the constructor), only the variation since the last call is added to the totals
+	void collect(const size_t tid, const std::vector<const module::Module*> &modules);
+
+	void show(std::ostream &stream = std::cout, const bool ordered = false) const;
+
+	size_t get_n_threads() const;
+	size_t get_n_tasks  () const;
+
+	// the totals can be read by any thread while the threads collect their statistics (lock-free)
+	const std::string& get_module_name(const size_t row) const;
+	const std::string& get_task_name  (const size_t row) const;
+	uint64_t           get_n_calls    (const size_t row) const;
+	int64_t            get_time       (const size_t row) const; // in ns
+	int64_t            get_thread_time(const size_t tid) const; // time spent in the tasks by a thread (in ns)
+
+	void reset();
+};
+}
+}
+
+#endif /* STATS_REDUCTION_HPP_ */
@@ -0,0 +1,119 @@
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+
+#include "Tools/Parameters/Parameters_key.hpp"
+#include "Tools/Store/Result_store.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+// 64-bit FNV-1a
+static uint64_t hash(const std::string &str)
+{
+	uint64_t h = 14695981039346656037ull;
+	for (auto c : str)
+	{
+		h ^= (uint64_t)(unsigned char)c;
+		h *= 1099511628211ull;
+	}
+	return h;
+}
+
+Result_store
+::Result_store(const std::string &path)
+: path(path)
+{
+	// load the points of the previous simulations (a truncated last line, after a crash, is ignored)
+	std::ifstream in(path);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		std::stringstream ss(line);
+		uint64_t key;
+		float ebn0;
+		Point pt;
+		if (ss >> std::hex >> key >> std::dec >> ebn0 >> pt.n_fra >> pt.n_be >> pt.n_fe >> pt.time)
+			this->points[std::make_pair(key, Result_store::snr_id(ebn0))] = pt;
+	}
+	in.close();
+
+	this->file.open(path, std::ios::out | std::ios::app);
+	if (!this->file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the result store ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+uint64_t Result_store
+::make_key(const std::vector<const factory::Factory::parameters*> &params)
+{
+	const std::string version = std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	return hash("aff3ct=" + version + ";" + tools::parameters_key(params));
+}
+
+int64_t Result_store
+::snr_id(const float ebn0)
+{
+	// the SNRs are computed by accumulating a step: compare them with a 1e-4 dB resolution
+	return (int64_t)std::llround((double)ebn0 * 1e4);
+}
+
+bool Result_store
+::find(const uint64_t key, const float ebn0, Point &pt) const
+{
+	std::lock_guard<std::mutex> lock(this->mtx);
+	auto it = this->points.find(std::make_pair(key, Result_store::snr_id(ebn0)));
+	if (it == this->points.end())
+		return false;
+	pt = it->second;
+	return true;
+}
+
+void Result_store
+::store(const uint64_t key, const float ebn0, const Point &pt)
+{
+	std::stringstream line;
+	line << std::hex << std::setw(16) << std::setfill('0') << key << std::dec << std::setfill(' ')
+	     << " " << std::fixed << std::setprecision(4) << ebn0
+	     << " " << pt.n_fra << " " << pt.n_be << " " << pt.n_fe
+	     << " " << std::setprecision(6) << pt.time << "\n";
+
+	std::lock_guard<std::mutex> lock(this->mtx);
+	this->points[std::make_pair(key, Result_store::snr_id(ebn0))] = pt;
+	this->file << line.str() << std::flush; // one write per point
+}
+
+size_t Result_store
+::size() const
+{
+	std::lock_guard<std::mutex> lock(this->mtx);
+	return this->points.size();
+}
+
+const std::string& Result_store
+::get_path() const
+{
+	return this->path;
+}
+
+void Result_store
+::display(std::ostream &stream, const float ebn0, const int K, const Point &pt)
+{
+	const auto ber = pt.n_fra ? (double)pt.n_be / ((double)pt.n_fra * K) : 0.;
+	const auto fer = pt.n_fra ? (double)pt.n_fe / (double)pt.n_fra       : 0.;
+
+	std::stringstream line;
+	line << "# Eb/N0 = " << std::fixed << std::setprecision(2) << ebn0 << " dB: stored result (FRA = " << pt.n_fra
+	     << ", BE = " << pt.n_be << ", FE = " << pt.n_fe << ", BER = " << std::scientific << ber << ", FER = " << fer
+	     << ")";
+	stream << line.str() << std::endl;
+}
@@ -0,0 +1,62 @@
+#ifndef RESULT_STORE_HPP_
+#define RESULT_STORE_HPP_
+
+#include <cstdint>
+#include <iostream>
+#include <fstream>
+#include <utility>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <map>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// persistent store of the simulated SNR points: a text file where each line is one SNR point of one simulated system
+// (= one set of parameters), identified by a hash of the parameters, of the AFF3CT version and of the SNR. The file is
+// loaded when the store is opened, then the new points are appended (and flushed) as soon as they are simulated, a
+// simulation that crashed does not lose the points it finished. Several simulations can share the same file.
+class Result_store
+{
+public:
+	struct Point
+	{
+		unsigned long long n_fra;
+		unsigned long long n_be;
+		unsigned long long n_fe;
+		double             time; // simulation time (in seconds)
+	};
+
+protected:
+	const std::string                                path;
+	std::map<std::pair<uint64_t,int64_t>, Point>     points; // key = (hash of the parameters, SNR in 1e-4 dB)
+	std::ofstream                                    file;
+	mutable std::mutex                               mtx;
+
+public:
+	explicit Result_store(const std::string &path);
+	virtual ~Result_store() = default;
+
+	// hash of the parameters that define the simulated system and of the library version (the parameters that do
+	// not change the results, like the terminal ones, should not be given)
+	static uint64_t make_key(const std::vector<const factory::Factory::parameters*> &params);
+
+	bool find (const uint64_t key, const float ebn0, Point &pt) const;
+	void store(const uint64_t key, const float ebn0, const Point &pt);
+
+	size_t size() const;
+	const std::string& get_path() const;
+
+	static void display(std::ostream &stream, const float ebn0, const int K, const Point &pt);
+
+protected:
+	static int64_t snr_id(const float ebn0);
+};
+}
+}
+
+#endif /* RESULT_STORE_HPP_ */
@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+#include <cmath>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Sweep/Sweep_plan.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static std::vector<std::string> split(const std::string &str, const char delim)
+{
+	std::vector<std::string> tokens;
+	std::stringstream ss(str);
+	std::string token;
+	while (std::getline(ss, token, delim))
+		if (!token.empty())
+			tokens.push_back(token);
+	return tokens;
+}
+
+static double to_number(const std::string &str)
+{
+	char* end = nullptr;
+	const auto val = std::strtod(str.c_str(), &end);
+	if (str.empty() || *end != '\0')
+	{
+		std::stringstream message;
+		message << "'str' is not a number ('str' = " << str << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+	return val;
+}
+
+static std::string to_string(const double val)
+{
+	std::stringstream ss;
+	ss.precision(12);
+	ss << val;
+	return ss.str();
+}
+
+Sweep_plan
+::Sweep_plan(const std::string &spec, const Aliases &aliases)
+{
+	for (auto &d : split(spec, ';'))
+	{
+		const auto eq = d.find('=');
+		if (eq == std::string::npos || eq == 0 || eq == d.size() -1)
+		{
+			std::stringstream message;
+			message << "A swept parameter has to be written 'ARG=VALUES' ('d' = " << d << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const auto arg = d.substr(0, eq);
+		this->dimensions.push_back({arg, Sweep_plan::expand(d.substr(eq +1)),
+		                            aliases ? aliases(arg) : std::vector<std::string>{arg}});
+	}
+
+	if (this->dimensions.empty())
+	{
+		std::stringstream message;
+		message << "'spec' does not contain any swept parameter ('spec' = " << spec << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+std::vector<std::string> Sweep_plan
+::expand(const std::string &values)
+{
+	// list of values
+	if (values.find(':') == std::string::npos)
+		return split(values, ',');
+
+	// range of values
+	const auto range = split(values, ':');
+	if (range.size() != 3)
+	{
+		std::stringstream message;
+		message << "A range has to be written 'min:step:max' or 'min:xfactor:max' ('values' = " << values << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto min = to_number(range[0]);
+	const auto max = to_number(range[2]);
+	const auto geo = range[1][0] == 'x';
+	const auto inc = to_number(geo ? range[1].substr(1) : range[1]);
+
+	if ((geo && inc <= 1.) || (!geo && inc <= 0.) || max < min)
+	{
+		std::stringstream message;
+		message << "The range is empty or infinite ('values' = " << values << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<std::string> expanded;
+	const auto eps = 1e-9 * std::max(1., std::abs(max));
+	if (geo)
+		for (auto v = min; v <= max + eps; v *= inc)
+			expanded.push_back(to_string(v));
+	else // compute each value from 'min' to avoid the accumulation of the rounding errors
+		for (size_t i = 0; min + (double)i * inc <= max + eps; i++)
+			expanded.push_back(to_string(min + (double)i * inc));
+
+	return expanded;
+}
+
+const std::vector<Sweep_plan::Dimension>& Sweep_plan
+::get_dimensions() const
+{
+	return this->dimensions;
+}
+
+size_t Sweep_plan
+::get_n_jobs() const
+{
+	size_t n_jobs = 1;
+	for (auto &d : this->dimensions)
+		n_jobs *= d.values.size();
+	return n_jobs;
+}
+
+std::vector<std::string> Sweep_plan
+::get_values(const size_t j) const
+{
+	if (j >= this->get_n_jobs())
+	{
+		std::stringstream message;
+		message << "'j' has to be smaller than the number of jobs ('j' = " << j
+		        << ", 'get_n_jobs()' = " << this->get_n_jobs() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<std::string> values(this->dimensions.size());
+	auto idx = j;
+	for (size_t d = this->dimensions.size(); d > 0; d--)
+	{
+		const auto &dim = this->dimensions[d -1];
+		values[d -1] = dim.values[idx % dim.values.size()];
+		idx /= dim.values.size();
+	}
+	return values;
+}
+
+std::vector<std::string> Sweep_plan
+::get_args(const size_t j, const std::vector<std::string> &base) const
+{
+	auto args = base;
+	const auto values = this->get_values(j);
+	for (size_t d = 0; d < this->dimensions.size(); d++)
+	{
+		args = Sweep_plan::remove_args(args, this->dimensions[d].aliases);
+		args.push_back(this->dimensions[d].arg);
+		args.push_back(values[d]);
+	}
+	return args;
+}
+
+bool Sweep_plan
+::is_value(const std::string &arg)
+{
+	if (arg.empty() || arg[0] != '-')
+		return true;
+
+	// negative numbers are values, not arguments
+	char* end = nullptr;
+	std::strtod(arg.c_str(), &end);
+	return *end == '\0';
+}
+
+std::vector<std::string> Sweep_plan
+::remove_args(const std::vector<std::string> &args, const std::string &name, const bool is_prefix)
+{
+	if (!is_prefix)
+		return Sweep_plan::remove_args(args, std::vector<std::string>{name});
+
+	std::vector<std::string> kept;
+	for (size_t a = 0; a < args.size(); a++)
+	{
+		if (!Sweep_plan::is_value(args[a]) && args[a].compare(0, name.size(), name) == 0)
+		{
+			// skip the values of the removed argument
+			while (a +1 < args.size() && Sweep_plan::is_value(args[a +1]))
+				a++;
+			continue;
+		}
+		kept.push_back(args[a]);
+	}
+	return kept;
+}
+
+std::vector<std::string> Sweep_plan
+::remove_args(const std::vector<std::string> &args, const std::vector<std::string> &names)
+{
+	std::vector<std::string> kept;
+	for (size_t a = 0; a < args.size(); a++)
+	{
+		const auto match = std::find(names.begin(), names.end(), args[a]) != names.end();
+		if (!Sweep_plan::is_value(args[a]) && match)
+		{
+			// skip the values of the removed argument
+			while (a +1 < args.size() && Sweep_plan::is_value(args[a +1]))
+				a++;
+			continue;
+		}
+		kept.push_back(args[a]);
+	}
+	return kept;
+}
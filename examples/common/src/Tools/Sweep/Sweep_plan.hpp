@@ -0,0 +1,61 @@
+#ifndef SWEEP_PLAN_HPP_
+#define SWEEP_PLAN_HPP_
+
+#include <functional>
+#include <vector>
+#include <string>
+
+namespace aff3ct
+{
+namespace tools
+{
+// cartesian product of the swept parameters: each job is a full command line where the swept arguments take one of
+// their values (the last dimension varies the fastest, so consecutive jobs share most of their modules)
+class Sweep_plan
+{
+public:
+	struct Dimension
+	{
+		std::string              arg;     // e.g. "-K" or "--mdm-type"
+		std::vector<std::string> values;  // e.g. {"32", "64", "128"}
+		std::vector<std::string> aliases; // all the spellings of 'arg', e.g. {"-K", "--src-info-bits", ...}
+	};
+
+	// give all the spellings of a command line argument (including the argument itself)
+	using Aliases = std::function<std::vector<std::string>(const std::string &arg)>;
+
+protected:
+	std::vector<Dimension> dimensions;
+
+public:
+	// 'spec' = "ARG=v1,v2,...;ARG=min:step:max;ARG=min:xfactor:max", the swept arguments replace all their 'aliases'
+	// in the command lines of the jobs (only the argument itself when 'aliases' is empty)
+	explicit Sweep_plan(const std::string &spec, const Aliases &aliases = nullptr);
+	virtual ~Sweep_plan() = default;
+
+	const std::vector<Dimension>& get_dimensions() const;
+	size_t get_n_jobs() const;
+
+	// the values of the swept parameters for the job 'j' (one per dimension)
+	std::vector<std::string> get_values(const size_t j) const;
+
+	// the command line of the job 'j' = the 'base' command line where the swept arguments are replaced
+	std::vector<std::string> get_args(const size_t j, const std::vector<std::string> &base) const;
+
+	// remove the argument 'name' (or all the arguments starting by 'name' when 'is_prefix') and its values from a
+	// command line
+	static std::vector<std::string> remove_args(const std::vector<std::string> &args, const std::string &name,
+	                                            const bool is_prefix = true);
+
+	// remove all the arguments of 'names' (exact match) and their values from a command line
+	static std::vector<std::string> remove_args(const std::vector<std::string> &args,
+	                                            const std::vector<std::string> &names);
+
+protected:
+	static std::vector<std::string> expand(const std::string &values);
+	static bool is_value(const std::string &arg);
+};
+}
+}
+
+#endif /* SWEEP_PLAN_HPP_ */
@@ -0,0 +1,38 @@
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Monitor_snapshot
+::Monitor_snapshot()
+: seq(0), n_fra(0), n_be(0), n_fe(0), prev_n_fra(0), prev_n_be(0), prev_n_fe(0),
+  t_start(clock::now().time_since_epoch().count())
+{
+}
+
+double Monitor_snapshot
+::get_elapsed() const
+{
+	const auto t_start = clock::time_point(clock::duration(this->t_start.load(std::memory_order_relaxed)));
+	return std::chrono::duration<double>(clock::now() - t_start).count();
+}
+
+void Monitor_snapshot
+::reset()
+{
+	// the counters move to the totals in a single update: a reader never sees them twice or not at all
+	const auto s = this->seq.load(std::memory_order_relaxed);
+	this->seq.store(s + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	const auto relaxed = std::memory_order_relaxed;
+	this->prev_n_fra.store(this->prev_n_fra.load(relaxed) + this->n_fra.load(relaxed), relaxed);
+	this->prev_n_be .store(this->prev_n_be .load(relaxed) + this->n_be .load(relaxed), relaxed);
+	this->prev_n_fe .store(this->prev_n_fe .load(relaxed) + this->n_fe .load(relaxed), relaxed);
+	this->n_fra.store(0, relaxed);
+	this->n_be .store(0, relaxed);
+	this->n_fe .store(0, relaxed);
+
+	this->seq.store(s + 2, std::memory_order_release);
+	this->t_start.store(clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
@@ -0,0 +1,62 @@
+#ifndef MONITOR_SNAPSHOT_HPP_
+#define MONITOR_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+
+namespace aff3ct
+{
+namespace tools
+{
+// counters of a monitor published by the thread that runs it (seqlock): 'publish' never waits and does not write
+// anything else than its own cache line, 'read' retries until it gets counters that were not being modified. The
+// reporters read the snapshots instead of the monitors, the worker threads are not slowed down by the terminal.
+class alignas(64) Monitor_snapshot
+{
+public:
+	struct Counters
+	{
+		uint64_t n_fra; // number of analyzed frames
+		uint64_t n_be;  // number of bit errors
+		uint64_t n_fe;  // number of frame errors
+	};
+
+protected:
+	using clock = std::chrono::steady_clock;
+
+	std::atomic<uint64_t> seq; // odd while the writer publishes
+	std::atomic<uint64_t> n_fra;
+	std::atomic<uint64_t> n_be;
+	std::atomic<uint64_t> n_fe;
+	std::atomic<uint64_t> prev_n_fra; // sums of the counters of the previous SNR points
+	std::atomic<uint64_t> prev_n_be;
+	std::atomic<uint64_t> prev_n_fe;
+	std::atomic<int64_t>  t_start; // beginning of the SNR point (clock ticks)
+
+public:
+	Monitor_snapshot();
+	virtual ~Monitor_snapshot() = default;
+
+	// only one thread can publish
+	inline void publish(const uint64_t n_fra, const uint64_t n_be, const uint64_t n_fe);
+
+	// any thread, lock-free
+	inline Counters read() const;
+
+	// counters summed over all the SNR points (they never decrease), any thread, lock-free
+	inline Counters read_total() const;
+
+	// elapsed time since the last reset (in seconds)
+	double get_elapsed() const;
+
+	// zero counters (added to the totals) and new start time, to call when the writer does not publish (between two
+	// SNR points)
+	void reset();
+};
+}
+}
+
+#include "Tools/Terminal/Monitor_snapshot.hxx"
+
+#endif /* MONITOR_SNAPSHOT_HPP_ */
@@ -0,0 +1,63 @@
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Monitor_snapshot
+::publish(const uint64_t n_fra, const uint64_t n_be, const uint64_t n_fe)
+{
+	const auto s = this->seq.load(std::memory_order_relaxed);
+	this->seq.store(s + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	this->n_fra.store(n_fra, std::memory_order_relaxed);
+	this->n_be .store(n_be,  std::memory_order_relaxed);
+	this->n_fe .store(n_fe,  std::memory_order_relaxed);
+
+	this->seq.store(s + 2, std::memory_order_release);
+}
+
+Monitor_snapshot::Counters Monitor_snapshot
+::read() const
+{
+	Counters c;
+	uint64_t s1, s2;
+	do
+	{
+		s1 = this->seq.load(std::memory_order_acquire);
+
+		c.n_fra = this->n_fra.load(std::memory_order_relaxed);
+		c.n_be  = this->n_be .load(std::memory_order_relaxed);
+		c.n_fe  = this->n_fe .load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		s2 = this->seq.load(std::memory_order_relaxed);
+	}
+	while ((s1 & 1) || s1 != s2);
+
+	return c;
+}
+
+Monitor_snapshot::Counters Monitor_snapshot
+::read_total() const
+{
+	Counters c;
+	uint64_t s1, s2;
+	do
+	{
+		s1 = this->seq.load(std::memory_order_acquire);
+
+		c.n_fra = this->prev_n_fra.load(std::memory_order_relaxed) + this->n_fra.load(std::memory_order_relaxed);
+		c.n_be  = this->prev_n_be .load(std::memory_order_relaxed) + this->n_be .load(std::memory_order_relaxed);
+		c.n_fe  = this->prev_n_fe .load(std::memory_order_relaxed) + this->n_fe .load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		s2 = this->seq.load(std::memory_order_relaxed);
+	}
+	while ((s1 & 1) || s1 != s2);
+
+	return c;
+}
+}
+}
@@ -0,0 +1,88 @@
+#include <iomanip>
+#include <sstream>
+
+#include "Tools/Terminal/Reporter_snapshot.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Reporter_snapshot
+::Reporter_snapshot(const std::vector<const Monitor_snapshot*> &snapshots, const int K)
+: snapshots(snapshots), K(K)
+{
+	if (snapshots.empty())
+	{
+		std::stringstream message;
+		message << "'snapshots' should not be empty.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	title_t bfer_title = {"Bit Error Rate (BER) and Frame Error Rate (FER)", ""};
+	this->cols_groups.push_back(std::make_pair(bfer_title, std::vector<title_t>()));
+	this->cols_groups.back().second.push_back(std::make_pair("FRA", ""));
+	this->cols_groups.back().second.push_back(std::make_pair("BE",  ""));
+	this->cols_groups.back().second.push_back(std::make_pair("FE",  ""));
+	this->cols_groups.back().second.push_back(std::make_pair("BER", ""));
+	this->cols_groups.back().second.push_back(std::make_pair("FER", ""));
+
+	title_t thr_title = {"Global throughput", "and elapsed time"};
+	this->cols_groups.push_back(std::make_pair(thr_title, std::vector<title_t>()));
+	this->cols_groups.back().second.push_back(std::make_pair("SIM_THR", "(Mb/s)"));
+	this->cols_groups.back().second.push_back(std::make_pair("ET/RT",   "(hhmmss)"));
+}
+
+Monitor_snapshot::Counters Reporter_snapshot
+::get_counters() const
+{
+	Monitor_snapshot::Counters sum = {0, 0, 0};
+	for (auto s : this->snapshots)
+	{
+		const auto c = s->read();
+		sum.n_fra += c.n_fra;
+		sum.n_be  += c.n_be;
+		sum.n_fe  += c.n_fe;
+	}
+	return sum;
+}
+
+double Reporter_snapshot
+::get_elapsed() const
+{
+	return this->snapshots.front()->get_elapsed();
+}
+
+int Reporter_snapshot
+::get_K() const
+{
+	return this->K;
+}
+
+Reporter::report_t Reporter_snapshot
+::report(bool final)
+{
+	const auto c       = this->get_counters();
+	const auto elapsed = this->get_elapsed();
+	const auto ber     = c.n_fra ? (double)c.n_be / ((double)c.n_fra * (double)this->K) : 0.;
+	const auto fer     = c.n_fra ? (double)c.n_fe /  (double)c.n_fra                    : 0.;
+	const auto thr     = elapsed > 0. ? (double)c.n_fra * (double)this->K / elapsed * 1e-6 : 0.;
+
+	report_t the_report(this->cols_groups.size());
+
+	auto& bfer_report = the_report[0];
+	std::stringstream str_ber, str_fer;
+	str_ber << std::setprecision(2) << std::scientific << ber;
+	str_fer << std::setprecision(2) << std::scientific << fer;
+	bfer_report.push_back(std::to_string(c.n_fra));
+	bfer_report.push_back(std::to_string(c.n_be ));
+	bfer_report.push_back(std::to_string(c.n_fe ));
+	bfer_report.push_back(str_ber.str());
+	bfer_report.push_back(str_fer.str());
+
+	auto& thr_report = the_report[1];
+	std::stringstream str_thr;
+	str_thr << std::setprecision(3) << std::fixed << thr;
+	thr_report.push_back(str_thr.str());
+	thr_report.push_back(tools::get_time_format(elapsed));
+
+	return the_report;
+}
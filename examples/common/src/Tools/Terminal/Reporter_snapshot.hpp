@@ -0,0 +1,39 @@
+#ifndef REPORTER_SNAPSHOT_HPP_
+#define REPORTER_SNAPSHOT_HPP_
+
+#include <vector>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// bit/frame error rates and throughput of the simulation (the same columns as 'Reporter_BFER' and
+// 'Reporter_throughput'), computed from the snapshots of the monitors of the threads (summed)
+class Reporter_snapshot : public Reporter
+{
+protected:
+	const std::vector<const Monitor_snapshot*> snapshots;
+	const int                                  K; // number of information bits per frame
+
+public:
+	Reporter_snapshot(const std::vector<const Monitor_snapshot*> &snapshots, const int K);
+	virtual ~Reporter_snapshot() = default;
+
+	// sum of the counters of the snapshots
+	Monitor_snapshot::Counters get_counters() const;
+
+	// elapsed time of the current SNR point (in seconds)
+	double get_elapsed() const;
+
+	int get_K() const;
+
+	report_t report(bool final = false);
+};
+}
+}
+
+#endif /* REPORTER_SNAPSHOT_HPP_ */
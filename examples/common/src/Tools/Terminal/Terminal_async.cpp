@@ -0,0 +1,79 @@
+#include "Tools/Terminal/Terminal_async.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Buffer_streambuf
+::Buffer_streambuf(const size_t capacity)
+: block(capacity ? capacity : 1)
+{
+	this->clear();
+}
+
+const char* Buffer_streambuf
+::data() const
+{
+	return this->pbase();
+}
+
+size_t Buffer_streambuf
+::size() const
+{
+	return (size_t)(this->pptr() - this->pbase());
+}
+
+void Buffer_streambuf
+::clear()
+{
+	this->setp(this->block.data(), this->block.data() + this->block.size());
+}
+
+Buffer_streambuf::int_type Buffer_streambuf
+::overflow(int_type c)
+{
+	if (traits_type::eq_int_type(c, traits_type::eof()))
+		return traits_type::not_eof(c);
+
+	const auto n = this->size();
+	this->block.resize(2 * this->block.size());
+	this->setp(this->block.data(), this->block.data() + this->block.size());
+	this->pbump((int)n);
+
+	*this->pptr() = traits_type::to_char_type(c);
+	this->pbump(1);
+	return c;
+}
+
+Terminal_async
+::Terminal_async(const std::vector<std::unique_ptr<tools::Reporter>>& reporters, const size_t capacity)
+: Terminal_std(reporters),
+  temp_buffer(capacity),
+  final_buffer(capacity),
+  temp_stream(&temp_buffer),
+  final_stream(&final_buffer)
+{
+}
+
+void Terminal_async
+::temp_report(std::ostream &stream)
+{
+	this->temp_buffer.clear();
+	Terminal_std::temp_report(this->temp_stream);
+	Terminal_async::write(stream, this->temp_buffer);
+}
+
+void Terminal_async
+::final_report(std::ostream &stream)
+{
+	// separate buffer: the background thread may be formatting a temporary report
+	this->final_buffer.clear();
+	Terminal_std::final_report(this->final_stream);
+	Terminal_async::write(stream, this->final_buffer);
+}
+
+void Terminal_async
+::write(std::ostream &stream, Buffer_streambuf &buffer)
+{
+	stream.write(buffer.data(), (std::streamsize)buffer.size());
+	stream.flush();
+}
@@ -0,0 +1,59 @@
+#ifndef TERMINAL_ASYNC_HPP_
+#define TERMINAL_ASYNC_HPP_
+
+#include <streambuf>
+#include <ostream>
+#include <memory>
+#include <vector>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// stream buffer in a preallocated memory block (the block only grows if a report does not fit in it)
+class Buffer_streambuf : public std::streambuf
+{
+protected:
+	std::vector<char> block;
+
+public:
+	explicit Buffer_streambuf(const size_t capacity);
+	virtual ~Buffer_streambuf() = default;
+
+	const char* data() const;
+	size_t      size() const;
+	void        clear();
+
+protected:
+	int_type overflow(int_type c);
+};
+
+// terminal of the library ('Terminal_std' formatting) that writes each report in a preallocated buffer and sends it to
+// the output stream with a single write (no flush for each line): the temporary reports of the background thread do
+// not interleave with the other outputs. With the 'Reporter_snapshot', the reporting thread never reads the monitors
+// that the worker threads are modifying.
+class Terminal_async : public Terminal_std
+{
+protected:
+	Buffer_streambuf temp_buffer; // temporary reports (background thread)
+	Buffer_streambuf final_buffer;
+	std::ostream     temp_stream;
+	std::ostream     final_stream;
+
+public:
+	explicit Terminal_async(const std::vector<std::unique_ptr<tools::Reporter>>& reporters,
+	                        const size_t capacity = 4096);
+	virtual ~Terminal_async() = default;
+
+	void temp_report (std::ostream &stream = std::cout);
+	void final_report(std::ostream &stream = std::cout);
+
+protected:
+	static void write(std::ostream &stream, Buffer_streambuf &buffer);
+};
+}
+}
+
+#endif /* TERMINAL_ASYNC_HPP_ */
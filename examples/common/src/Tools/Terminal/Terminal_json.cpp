@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+#include <cinttypes>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Tools/Terminal/Terminal_json.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Terminal_json
+::Terminal_json(const std::vector<std::unique_ptr<tools::Reporter>>& reporters, const Sigma<> *noise,
+                const std::string &path)
+: Terminal_async(reporters),
+  snapshot(nullptr),
+  noise(noise),
+  file(nullptr),
+  temp_line(512),
+  final_line(512)
+{
+	for (auto &r : reporters)
+		if (this->snapshot == nullptr)
+			this->snapshot = dynamic_cast<const Reporter_snapshot*>(r.get());
+
+	if (this->snapshot == nullptr)
+	{
+		std::stringstream message;
+		message << "'reporters' should contain a 'Reporter_snapshot'.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->file = Terminal_json::open(path);
+}
+
+Terminal_json
+::~Terminal_json()
+{
+	if (this->file != nullptr)
+		std::fclose(this->file);
+}
+
+void Terminal_json
+::temp_report(std::ostream &stream)
+{
+	Terminal_async::temp_report(stream);
+	this->write_line(this->temp_line, false);
+}
+
+void Terminal_json
+::final_report(std::ostream &stream)
+{
+	Terminal_async::final_report(stream);
+	this->write_line(this->final_line, true);
+}
+
+void Terminal_json
+::write_line(std::vector<char> &line, const bool final)
+{
+	const auto c       = this->snapshot->get_counters();
+	const auto elapsed = this->snapshot->get_elapsed();
+	const auto K       = (double)this->snapshot->get_K();
+	const auto ber     = c.n_fra ? (double)c.n_be / ((double)c.n_fra * K) : 0.;
+	const auto fer     = c.n_fra ? (double)c.n_fe /  (double)c.n_fra      : 0.;
+	const auto thr     = elapsed > 0. ? (double)c.n_fra * K / elapsed * 1e-6 : 0.;
+
+	// the SNR is 'null' when there is no noise (or before the first SNR point)
+	char str_snr[2][32] = {"null", "null"};
+	if (this->noise != nullptr && this->noise->is_set())
+	{
+		std::snprintf(str_snr[0], sizeof(str_snr[0]), "%.6f", (double)this->noise->get_ebn0());
+		std::snprintf(str_snr[1], sizeof(str_snr[1]), "%.6f", (double)this->noise->get_esn0());
+	}
+
+	const auto n = std::snprintf(line.data(), line.size(),
+	                             "{\"report\":\"%s\",\"ebn0\":%s,\"esn0\":%s,\"frames\":%" PRIu64 ",\"be\":%" PRIu64 ","
+	                             "\"fe\":%" PRIu64 ",\"ber\":%.6e,\"fer\":%.6e,\"throughput\":%.6f,\"elapsed\":%.6f}\n",
+	                             final ? "final" : "temp", str_snr[0], str_snr[1], (uint64_t)c.n_fra, (uint64_t)c.n_be,
+	                             (uint64_t)c.n_fe, ber, fer, thr, elapsed);
+
+	// one write per line: a reader never sees a partial object (the line is smaller than the buffer of the file)
+	if (n > 0)
+	{
+		std::fwrite(line.data(), 1, std::min((size_t)n, line.size() - 1), this->file);
+		std::fflush(this->file);
+	}
+}
+
+std::FILE* Terminal_json
+::open(const std::string &path)
+{
+	std::FILE *file = nullptr;
+	if (path.compare(0, 3, "fd:") == 0)
+	{
+		// the descriptor is duplicated, the terminal closes its own copy
+		const auto fd = std::atoi(path.c_str() + 3);
+#ifdef _WIN32
+		const auto dup_fd = _dup(fd);
+		if (dup_fd >= 0 && (file = _fdopen(dup_fd, "a")) == nullptr) _close(dup_fd);
+#else
+		const auto dup_fd = ::dup(fd);
+		if (dup_fd >= 0 && (file = ::fdopen(dup_fd, "a")) == nullptr) ::close(dup_fd);
+#endif
+	}
+	else
+		file = std::fopen(path.c_str(), "a");
+
+	if (file == nullptr)
+	{
+		std::stringstream message;
+		message << "The JSON output cannot be opened ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return file;
+}
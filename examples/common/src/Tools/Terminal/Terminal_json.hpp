@@ -0,0 +1,50 @@
+#ifndef TERMINAL_JSON_HPP_
+#define TERMINAL_JSON_HPP_
+
+#include <cstdio>
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Terminal/Terminal_async.hpp"
+#include "Tools/Terminal/Reporter_snapshot.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+// 'Terminal_async' that also writes each report as one JSON object per line (JSON lines) in a file or in an already
+// open file descriptor ("fd:N"), for the tools that monitor the simulations:
+// {"report":"temp","ebn0":4.000000,"esn0":-2.020600,"frames":1234,"be":56,"fe":7,"ber":1.418152e-03,
+//  "fer":5.672609e-03,"throughput":12.345678,"elapsed":3.198765}
+// The throughput is in Mb/s and the elapsed time (of the current SNR point) in seconds.
+// The counters are read from the 'Reporter_snapshot' of the reporters and the SNR from the noise of the simulation
+// (null when there is no noise or when it is not set), not from the formatted columns of the terminal.
+class Terminal_json : public Terminal_async
+{
+protected:
+	const Reporter_snapshot *snapshot;
+	const Sigma<>           *noise;
+	std::FILE               *file;
+	std::vector<char>        temp_line; // temporary reports (background thread)
+	std::vector<char>        final_line;
+
+public:
+	Terminal_json(const std::vector<std::unique_ptr<tools::Reporter>>& reporters, const Sigma<> *noise,
+	              const std::string &path);
+	virtual ~Terminal_json();
+
+	void temp_report (std::ostream &stream = std::cout);
+	void final_report(std::ostream &stream = std::cout);
+
+protected:
+	void write_line(std::vector<char> &line, const bool final);
+
+	static std::FILE* open(const std::string &path);
+};
+}
+}
+
+#endif /* TERMINAL_JSON_HPP_ */
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <sstream>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Workers/Workers_controller.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Workers_controller
+::Workers_controller(const size_t n_threads, const std::chrono::milliseconds window, const float min_gain,
+                     const bool enabled)
+: n_threads(n_threads),
+  window(window),
+  min_gain(min_gain),
+  enabled(enabled),
+  counters(n_threads),
+  n_active(n_threads),
+  released(false),
+  calibrating(false),
+  best_n_active(n_threads),
+  best_throughput(0.),
+  n_frames_start(0)
+{
+	if (n_threads == 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (window.count() <= 0)
+	{
+		std::stringstream message;
+		message << "'window' has to be greater than 0 ('window' = " << window.count() << " ms).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (min_gain < 0.f)
+	{
+		std::stringstream message;
+		message << "'min_gain' has to be positive ('min_gain' = " << min_gain << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &c : this->counters)
+		c.n_frames = 0;
+}
+
+void Workers_controller
+::start()
+{
+	this->released = false;
+
+	if (!this->enabled || this->n_threads == 1)
+	{
+		this->set_n_active(this->n_threads);
+		this->calibrating = false;
+		return;
+	}
+
+	// the calibration begins with a single worker
+	this->best_n_active   = 1;
+	this->best_throughput = 0.;
+	this->n_frames_start  = this->get_n_frames();
+	this->t_start         = clock::now();
+	this->set_n_active(1);
+	this->calibrating = true;
+}
+
+void Workers_controller
+::park(const size_t tid)
+{
+	std::unique_lock<std::mutex> lock(this->mtx);
+	this->cv.wait(lock, [this, tid]() { return this->released.load() || this->is_active(tid); });
+}
+
+void Workers_controller
+::release()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->released    = true;
+		this->calibrating = false;
+	}
+	this->cv.notify_all();
+}
+
+size_t Workers_controller
+::get_n_active() const
+{
+	return this->n_active;
+}
+
+size_t Workers_controller
+::get_n_threads() const
+{
+	return this->n_threads;
+}
+
+bool Workers_controller
+::is_calibrating() const
+{
+	return this->calibrating;
+}
+
+uint64_t Workers_controller
+::get_n_frames() const
+{
+	uint64_t n_frames = 0;
+	for (auto &c : this->counters)
+		n_frames += c.n_frames.load(std::memory_order_relaxed);
+	return n_frames;
+}
+
+void Workers_controller
+::next_step()
+{
+	const auto t_stop   = clock::now();
+	const auto n_frames = this->get_n_frames();
+	const auto elapsed  = std::chrono::duration<double>(t_stop - this->t_start).count();
+	const auto cur_n    = this->n_active.load();
+	const auto thr      = (double)(n_frames - this->n_frames_start) / elapsed; // frames per second
+
+	const bool improved = thr >= this->best_throughput * (1. + (double)this->min_gain);
+	if (improved)
+	{
+		this->best_n_active   = cur_n;
+		this->best_throughput = thr;
+	}
+
+	if (!improved || cur_n == this->n_threads)
+	{
+		// the extra workers do not raise the throughput enough: keep the best configuration until the end of the SNR
+		this->calibrating = false;
+		this->set_n_active(this->best_n_active);
+		return;
+	}
+
+	this->n_frames_start = n_frames;
+	this->t_start        = t_stop;
+	this->set_n_active(std::min(2 * cur_n, this->n_threads));
+}
+
+void Workers_controller
+::set_n_active(const size_t n_active)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->n_active = n_active;
+	}
+	this->cv.notify_all();
+}
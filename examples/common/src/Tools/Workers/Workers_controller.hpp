@@ -0,0 +1,84 @@
+#ifndef WORKERS_CONTROLLER_HPP_
+#define WORKERS_CONTROLLER_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <mutex>
+
+namespace aff3ct
+{
+namespace tools
+{
+// choose at runtime how many of the worker threads are really useful: at the beginning of each SNR point, the number of
+// active workers is doubled (1, 2, 4, ...) as long as the measured throughput (frames/s) grows by at least 'min_gain';
+// the other workers are parked (blocked on a condition variable) and their cores are released for the other jobs
+class Workers_controller
+{
+protected:
+	using clock = std::chrono::steady_clock;
+
+	// frames counter of one worker, padded to avoid the false sharing between the workers
+	struct Counter
+	{
+		std::atomic<uint64_t> n_frames;
+		char padding[64 - sizeof(std::atomic<uint64_t>)];
+	};
+
+	const size_t                    n_threads;
+	const std::chrono::milliseconds window;
+	const float                     min_gain;
+	const bool                      enabled;
+
+	std::vector<Counter>            counters;
+	std::atomic<size_t>             n_active;
+	std::atomic<bool>               released;
+	std::mutex                      mtx;
+	std::condition_variable         cv;
+
+	// calibration state, only accessed by the master thread
+	std::atomic<bool>               calibrating;
+	size_t                          best_n_active;
+	double                          best_throughput;
+	uint64_t                        n_frames_start;
+	clock::time_point               t_start;
+
+public:
+	Workers_controller(const size_t n_threads,
+	                   const std::chrono::milliseconds window = std::chrono::milliseconds(200),
+	                   const float min_gain = 0.05f,
+	                   const bool enabled = false);
+	virtual ~Workers_controller() = default;
+
+	// restart the calibration (has to be called by one thread while the workers are not running)
+	void start();
+
+	// move to the next calibration step when the current one is over (has to be called by the worker 0 only)
+	inline void update();
+
+	inline bool is_active  (const size_t tid) const;
+	inline void count_frame(const size_t tid);
+
+	// block the worker 'tid' until it becomes active or until the workers are released
+	void park(const size_t tid);
+
+	// wake up all the parked workers (at the end of an SNR point)
+	void release();
+
+	size_t get_n_active () const;
+	size_t get_n_threads() const;
+	bool   is_calibrating() const;
+
+protected:
+	uint64_t get_n_frames() const;
+	void next_step();
+	void set_n_active(const size_t n_active);
+};
+}
+}
+
+#include "Tools/Workers/Workers_controller.hxx"
+
+#endif /* WORKERS_CONTROLLER_HPP_ */
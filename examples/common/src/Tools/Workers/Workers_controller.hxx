@@ -0,0 +1,26 @@
+#include "Tools/Workers/Workers_controller.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Workers_controller
+::update()
+{
+	if (this->calibrating.load(std::memory_order_relaxed) && clock::now() - this->t_start >= this->window)
+		this->next_step();
+}
+
+bool Workers_controller
+::is_active(const size_t tid) const
+{
+	return tid < this->n_active.load(std::memory_order_relaxed);
+}
+
+void Workers_controller
+::count_frame(const size_t tid)
+{
+	this->counters[tid].n_frames.fetch_add(1, std::memory_order_relaxed);
+}
+}
+}
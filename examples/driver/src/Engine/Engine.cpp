@@ -0,0 +1,70 @@
+#include <iomanip>
+
+#include "Engine/Engine.hpp"
+
+using namespace aff3ct;
+
+Engine
+::Engine(const tools::Chain::parameters &params, const bool stats)
+: params(params), stats(stats)
+{
+}
+
+bool Engine
+::is_done(const std::function<bool()> &is_interrupt)
+{
+	return this->get_monitor().is_done() || is_interrupt();
+}
+
+std::vector<Engine::stage_stats> Engine
+::sum_stats(const std::vector<const tools::Chain*> &chains) const
+{
+	std::vector<stage_stats> stages;
+	if (!this->stats || chains.empty())
+		return stages;
+
+	for (auto &s : chains[0]->get_stages())
+		stages.push_back({ s.name, 0, std::chrono::nanoseconds(0) });
+
+	for (auto c : chains)
+	{
+		auto &chain_stages = c->get_stages();
+		for (size_t s = 0; s < chain_stages.size(); s++)
+		{
+			stages[s].n_calls  += (uint64_t)chain_stages[s].task->get_n_calls();
+			stages[s].duration +=           chain_stages[s].task->get_duration_total();
+		}
+	}
+	return stages;
+}
+
+void Engine
+::show_stats(std::ostream &stream) const
+{
+	const auto stages = this->get_stats();
+	if (stages.empty())
+		return;
+
+	auto total = std::chrono::nanoseconds(0);
+	for (auto &s : stages)
+		total += s.duration;
+
+	const std::string sep = "# ------------------------------|------------|------------|---------------|---------";
+	stream << "# Statistics of the stages ('" << this->get_name() << "' engine, summed over the threads):"
+	       << std::endl;
+	stream << sep << std::endl;
+	stream << "#                         STAGE |      CALLS |   TIME (s) | PER CALL (us) | TIME (%)" << std::endl;
+	stream << sep << std::endl;
+	for (auto &s : stages)
+	{
+		const auto t_sec  = (double)s.duration.count() * 1e-9;
+		const auto t_call = s.n_calls ? (double)s.duration.count() * 1e-3 / (double)s.n_calls : 0.;
+		const auto share  = total.count() ? 100. * (double)s.duration.count() / (double)total.count() : 0.;
+		stream << "# " << std::setw(29) << s.name << " | " << std::setw(10) << s.n_calls << " | "
+		       << std::fixed << std::setprecision(4) << std::setw(10) << t_sec << " | "
+		       << std::setprecision(2) << std::setw(13) << t_call << " | "
+		       << std::setw(7) << share << std::endl;
+	}
+	stream << sep << std::endl;
+	stream.unsetf(std::ios::floatfield);
+}
@@ -0,0 +1,65 @@
+#ifndef ENGINE_HPP_
+#define ENGINE_HPP_
+
+#include <functional>
+#include <iostream>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+
+#include "Tools/Chain/Chain.hpp"
+
+// an execution engine of the chain: all the engines build their chains from the same parameters and simulate the SNR
+// points with the same stop criterion, they only differ by the way (and by the threads) the stages are executed
+class Engine
+{
+public:
+	struct stage_stats
+	{
+		std::string              name;     // "module::task"
+		uint64_t                 n_calls;
+		std::chrono::nanoseconds duration; // summed over the threads
+	};
+
+protected:
+	const aff3ct::tools::Chain::parameters &params;
+	const bool                              stats;
+
+public:
+	Engine(const aff3ct::tools::Chain::parameters &params, const bool stats);
+	virtual ~Engine() = default;
+
+	virtual std::string get_name() const = 0;
+
+	// the monitor read by the reporters (the reduction of the monitors of the threads for a parallel engine)
+	virtual aff3ct::module::Monitor_BFER<>& get_monitor() = 0;
+
+	// the chains of the engine (one chain per thread for a parallel engine)
+	virtual std::vector<aff3ct::tools::Chain*> get_chains() = 0;
+
+	virtual void set_noise(const aff3ct::tools::Sigma<> &noise) = 0;
+
+	// simulate the current SNR point until 'is_done' returns true
+	virtual void run(const std::function<bool()> &is_interrupt) = 0;
+
+	// reset the monitors for the next SNR point
+	virtual void reset() = 0;
+
+	// statistics of the stages of the chain, summed over the threads (empty without statistics)
+	virtual std::vector<stage_stats> get_stats() const = 0;
+
+	void show_stats(std::ostream &stream = std::cout) const;
+
+protected:
+	// the stop criterion of all the engines: the monitor returned by 'get_monitor' is done (frame errors limit or
+	// frames limit) or 'is_interrupt' returns true
+	bool is_done(const std::function<bool()> &is_interrupt);
+
+	// sum the statistics of the tasks of the chains (the chains are built from the same parameters)
+	std::vector<stage_stats> sum_stats(const std::vector<const aff3ct::tools::Chain*> &chains) const;
+};
+
+#endif /* ENGINE_HPP_ */
@@ -0,0 +1,51 @@
+#include "Engine/Engine_direct.hpp"
+
+using namespace aff3ct;
+
+Engine_direct
+::Engine_direct(const tools::Chain::parameters &params, const bool stats)
+: Engine_tasks(params, stats, false), // the tasks are not executed (fast mode), the calls are timed by the engine
+  n_calls  (this->chain->get_stages().size(), 0),
+  durations(this->chain->get_stages().size(), std::chrono::nanoseconds(0))
+{
+}
+
+std::string Engine_direct
+::get_name() const
+{
+	return "DIRECT";
+}
+
+void Engine_direct
+::run(const std::function<bool()> &is_interrupt)
+{
+	auto &stages = this->chain->get_stages();
+	if (this->stats)
+	{
+		while (!this->is_done(is_interrupt))
+			for (size_t s = 0; s < stages.size(); s++)
+			{
+				const auto t_start = std::chrono::steady_clock::now();
+				stages[s].call();
+				this->durations[s] += std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - t_start);
+				this->n_calls[s]++;
+			}
+	}
+	else
+	{
+		while (!this->is_done(is_interrupt))
+			for (auto &s : stages)
+				s.call();
+	}
+}
+
+std::vector<Engine::stage_stats> Engine_direct
+::get_stats() const
+{
+	std::vector<stage_stats> stages;
+	if (this->stats)
+		for (size_t s = 0; s < this->chain->get_stages().size(); s++)
+			stages.push_back({ this->chain->get_stages()[s].name, this->n_calls[s], this->durations[s] });
+	return stages;
+}
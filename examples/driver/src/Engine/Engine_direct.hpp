@@ -0,0 +1,30 @@
+#ifndef ENGINE_DIRECT_HPP_
+#define ENGINE_DIRECT_HPP_
+
+#include <cstdint>
+#include <chrono>
+#include <vector>
+
+#include "Engine/Engine_tasks.hpp"
+
+// a single chain, the processing methods of the modules are called directly on the buffers of the sockets (like the
+// 'bootstrap' example): no task layer (no checks of the sockets and no task statistics), the stages are timed by the
+// engine itself
+class Engine_direct : public Engine_tasks
+{
+protected:
+	std::vector<uint64_t>                 n_calls;   // per stage
+	std::vector<std::chrono::nanoseconds> durations; // per stage
+
+public:
+	Engine_direct(const aff3ct::tools::Chain::parameters &params, const bool stats);
+	virtual ~Engine_direct() = default;
+
+	std::string get_name() const;
+
+	void run(const std::function<bool()> &is_interrupt);
+
+	std::vector<stage_stats> get_stats() const;
+};
+
+#endif /* ENGINE_DIRECT_HPP_ */
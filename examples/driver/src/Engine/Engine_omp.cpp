@@ -0,0 +1,109 @@
+#include "Engine/Engine_omp.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+inline int omp_get_thread_num () { return 0; }
+#endif
+
+using namespace aff3ct;
+
+namespace
+{
+int count_threads(const int n_threads)
+{
+#ifdef _OPENMP
+	return n_threads ? n_threads : omp_get_max_threads();
+#else
+	(void)n_threads;
+	return 1; // the 'omp parallel' regions are executed by a single thread
+#endif
+}
+}
+
+Engine_omp
+::Engine_omp(const tools::Chain::parameters &params, const bool stats, const int n_threads)
+: Engine(params, stats),
+  n_threads(count_threads(n_threads)),
+  monitors(this->n_threads),
+  chains  (this->n_threads)
+{
+#pragma omp parallel num_threads(this->n_threads)
+{
+	// each thread allocates its chain (on its NUMA node)
+	const int tid = omp_get_thread_num();
+	this->chains[tid] = std::unique_ptr<tools::Chain>(new tools::Chain(params, this->monitors[tid], tid, stats));
+}
+
+	// allocate a common monitor module to reduce all the monitors
+	this->monitor_red = std::unique_ptr<Monitor_BFER_reduction>(new Monitor_BFER_reduction(this->monitors));
+	this->monitor_red->set_reduce_frequency(std::chrono::milliseconds(500));
+}
+
+std::string Engine_omp
+::get_name() const
+{
+	return "OMP";
+}
+
+module::Monitor_BFER<>& Engine_omp
+::get_monitor()
+{
+	return *this->monitor_red;
+}
+
+std::vector<tools::Chain*> Engine_omp
+::get_chains()
+{
+	std::vector<tools::Chain*> chains;
+	for (auto &c : this->chains)
+		chains.push_back(c.get());
+	return chains;
+}
+
+void Engine_omp
+::set_noise(const tools::Sigma<> &noise)
+{
+	for (auto &c : this->chains)
+		c->set_noise(noise);
+}
+
+void Engine_omp
+::run(const std::function<bool()> &is_interrupt)
+{
+	auto &monitor_red = *this->monitor_red;
+
+#pragma omp parallel num_threads(this->n_threads)
+{
+	auto &chain = *this->chains[omp_get_thread_num()];
+	while (!this->is_done(is_interrupt))
+	{
+		chain.exec();
+		monitor_red.is_done_all(); // reduce the monitors of the threads in 'monitor_red' (every 500 ms)
+	}
+}
+
+	// final reduction
+	monitor_red.is_done_all(true, true);
+}
+
+void Engine_omp
+::reset()
+{
+	this->monitor_red->reset_all();
+}
+
+std::vector<Engine::stage_stats> Engine_omp
+::get_stats() const
+{
+	std::vector<const tools::Chain*> chains;
+	for (auto &c : this->chains)
+		chains.push_back(c.get());
+	return this->sum_stats(chains);
+}
+
+int Engine_omp
+::get_n_threads() const
+{
+	return this->n_threads;
+}
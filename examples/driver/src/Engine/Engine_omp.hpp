@@ -0,0 +1,43 @@
+#ifndef ENGINE_OMP_HPP_
+#define ENGINE_OMP_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "Engine/Engine.hpp"
+
+// one chain per OpenMP thread (like the 'openmp' example): each thread allocates its modules, the PRNGs of the chains
+// have different seeds and the monitors of the threads are reduced in a single monitor
+class Engine_omp : public Engine
+{
+protected:
+	using Monitor_BFER_reduction = aff3ct::module::Monitor_reduction_M<aff3ct::module::Monitor_BFER<>>;
+
+	const int                                                    n_threads;
+	std::vector<std::unique_ptr<aff3ct::module::Monitor_BFER<>>> monitors;    // the monitors of the threads
+	std::unique_ptr<Monitor_BFER_reduction>                      monitor_red; // reduction of the monitors
+	std::vector<std::unique_ptr<aff3ct::tools::Chain>>           chains;      // one chain per thread
+
+public:
+	// 'n_threads' = 0: all the OpenMP threads
+	Engine_omp(const aff3ct::tools::Chain::parameters &params, const bool stats, const int n_threads = 0);
+	virtual ~Engine_omp() = default;
+
+	std::string get_name() const;
+
+	aff3ct::module::Monitor_BFER<>& get_monitor();
+
+	std::vector<aff3ct::tools::Chain*> get_chains();
+
+	void set_noise(const aff3ct::tools::Sigma<> &noise);
+
+	void run(const std::function<bool()> &is_interrupt);
+
+	void reset();
+
+	std::vector<stage_stats> get_stats() const;
+
+	int get_n_threads() const;
+};
+
+#endif /* ENGINE_OMP_HPP_ */
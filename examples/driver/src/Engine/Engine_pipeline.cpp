@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <set>
+
+#include "Engine/Engine_pipeline.hpp"
+
+using namespace aff3ct;
+
+Engine_pipeline
+::Engine_pipeline(const tools::Chain::parameters &params, const bool stats, const size_t depth)
+: Engine(params, stats),
+  depth(depth),
+  chain(new tools::Chain(params, this->monitor, 0, stats)),
+  stop(false)
+{
+	if (depth == 0)
+	{
+		std::stringstream message;
+		message << "'depth' has to be greater than 0.";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the sockets of the transmitter and of the receiver
+	auto &stages = this->chain->get_stages();
+	std::set<const module::Socket*> tx, rx;
+	for (size_t s = 0; s < stages.size(); s++)
+		for (auto &sck : stages[s].task->sockets)
+			(s < this->chain->get_n_tx_stages() ? tx : rx).insert(sck.get());
+
+	for (auto &b : this->chain->get_bindings())
+		if (tx.count(b.out) && rx.count(b.in))
+			this->cut.push_back(b);
+
+	this->slots.resize(depth);
+	for (auto &slot : this->slots)
+		for (auto &b : this->cut)
+			slot.push_back(mipp::vector<int8_t>(b.out->get_databytes()));
+
+	this->ring.head       = 0;
+	this->ring.tail       = 0;
+	this->ring.tx_waiting = false;
+	this->ring.rx_waiting = false;
+}
+
+std::string Engine_pipeline
+::get_name() const
+{
+	return "PIPELINE";
+}
+
+module::Monitor_BFER<>& Engine_pipeline
+::get_monitor()
+{
+	return *this->monitor;
+}
+
+std::vector<tools::Chain*> Engine_pipeline
+::get_chains()
+{
+	return { this->chain.get() };
+}
+
+void Engine_pipeline
+::set_noise(const tools::Sigma<> &noise)
+{
+	this->chain->set_noise(noise);
+}
+
+void Engine_pipeline
+::transmit()
+{
+	auto &stages = this->chain->get_stages();
+	const auto n_tx = this->chain->get_n_tx_stages();
+
+	uint64_t tail = this->ring.tail.load(std::memory_order_relaxed);
+	while (!this->stop.load(std::memory_order_relaxed))
+	{
+		// wait for a free batch (the flag and the indices are sequentially consistent, so the receiver sees the flag
+		// or the transmitter sees the released batch)
+		if (tail - this->ring.head.load(std::memory_order_acquire) == this->depth)
+		{
+			std::unique_lock<std::mutex> lock(this->ring.mtx);
+			this->ring.tx_waiting = true;
+			this->ring.cv.wait(lock, [this, tail]()
+			{
+				return tail - this->ring.head.load() != this->depth || this->stop.load();
+			});
+			this->ring.tx_waiting = false;
+			continue;
+		}
+
+		for (size_t s = 0; s < n_tx; s++)
+			stages[s].task->exec();
+
+		auto &slot = this->slots[tail % this->depth];
+		for (size_t c = 0; c < this->cut.size(); c++)
+		{
+			auto data = static_cast<const int8_t*>(this->cut[c].out->get_dataptr());
+			std::copy(data, data + slot[c].size(), slot[c].begin());
+		}
+
+		this->ring.tail.store(++tail);
+		if (this->ring.rx_waiting.load())
+			this->wake();
+	}
+}
+
+void Engine_pipeline
+::wake()
+{
+	// taking the lock guarantees that the waiting thread is either before its check or already asleep
+	{ std::lock_guard<std::mutex> lock(this->ring.mtx); }
+	this->ring.cv.notify_all();
+}
+
+void Engine_pipeline
+::run(const std::function<bool()> &is_interrupt)
+{
+	auto &stages = this->chain->get_stages();
+	const auto n_tx = this->chain->get_n_tx_stages();
+
+	// the batches in flight at the end of the previous SNR point were dropped
+	this->ring.head.store(0);
+	this->ring.tail.store(0);
+	this->stop.store(false);
+	std::thread transmitter(&Engine_pipeline::transmit, this);
+
+	uint64_t head = 0;
+	while (!this->is_done(is_interrupt))
+	{
+		// wait for the next batch
+		if (this->ring.tail.load(std::memory_order_acquire) == head)
+		{
+			std::unique_lock<std::mutex> lock(this->ring.mtx);
+			this->ring.rx_waiting = true;
+			this->ring.cv.wait(lock, [this, head]() { return this->ring.tail.load() != head; });
+			this->ring.rx_waiting = false;
+		}
+
+		// the receiver reads the batch in the ring
+		auto &slot = this->slots[head % this->depth];
+		for (size_t c = 0; c < this->cut.size(); c++)
+			this->cut[c].in->bind((void*)slot[c].data());
+
+		for (size_t s = n_tx; s < stages.size(); s++)
+			stages[s].task->exec();
+
+		this->ring.head.store(++head);
+		if (this->ring.tx_waiting.load())
+			this->wake();
+	}
+
+	this->stop.store(true);
+	this->wake();
+	transmitter.join();
+}
+
+void Engine_pipeline
+::reset()
+{
+	this->monitor->reset();
+}
+
+std::vector<Engine::stage_stats> Engine_pipeline
+::get_stats() const
+{
+	return this->sum_stats({ this->chain.get() });
+}
@@ -0,0 +1,70 @@
+#ifndef ENGINE_PIPELINE_HPP_
+#define ENGINE_PIPELINE_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <mutex>
+
+#include <mipp.h>
+
+#include "Engine/Engine.hpp"
+
+// a single chain cut in two stages running on two threads: the transmitter (source to channel) and the receiver
+// (demodulation to monitor). The transmitter copies its outputs that are read by the receiver (the noisy symbols, the
+// channel gains and the source bits for the monitor) in a ring of 'depth' batches of frames, the input sockets of the
+// receiver are bound to the batch it processes. The ring has a single producer and a single consumer (no lock while
+// the ring is neither full nor empty, otherwise the waiting thread sleeps on a condition variable). The modem is shared
+// by the two stages (its 'modulate' and 'demodulate' tasks run in parallel). The batches in flight at the end of an SNR
+// point are dropped.
+class Engine_pipeline : public Engine
+{
+protected:
+	// indices of the ring, padded to avoid the false sharing between the transmitter and the receiver
+	struct Ring
+	{
+		std::atomic<uint64_t> head; // next batch to read (written by the receiver)
+		char padding1[64 - sizeof(std::atomic<uint64_t>)];
+		std::atomic<uint64_t> tail; // next batch to write (written by the transmitter)
+		char padding2[64 - sizeof(std::atomic<uint64_t>)];
+
+		std::atomic<bool>       tx_waiting; // the transmitter sleeps (the ring is full)
+		std::atomic<bool>       rx_waiting; // the receiver sleeps (the ring is empty)
+		std::mutex              mtx;
+		std::condition_variable cv;
+	};
+
+	const size_t                                    depth;
+	std::unique_ptr<aff3ct::module::Monitor_BFER<>> monitor;
+	std::unique_ptr<aff3ct::tools::Chain>           chain;
+	std::vector<aff3ct::tools::Chain::binding>      cut;   // bindings from the transmitter to the receiver
+	std::vector<std::vector<mipp::vector<int8_t>>>  slots; // [batch][binding of the cut]
+	Ring                                            ring;
+	std::atomic<bool>                               stop;  // stop the transmitter
+
+public:
+	Engine_pipeline(const aff3ct::tools::Chain::parameters &params, const bool stats, const size_t depth = 4);
+	virtual ~Engine_pipeline() = default;
+
+	std::string get_name() const;
+
+	aff3ct::module::Monitor_BFER<>& get_monitor();
+
+	std::vector<aff3ct::tools::Chain*> get_chains();
+
+	void set_noise(const aff3ct::tools::Sigma<> &noise);
+
+	void run(const std::function<bool()> &is_interrupt);
+
+	void reset();
+
+	std::vector<stage_stats> get_stats() const;
+
+protected:
+	void transmit();
+	void wake();
+};
+
+#endif /* ENGINE_PIPELINE_HPP_ */
@@ -0,0 +1,136 @@
+#ifdef AFF3CT_SYSTEMC_MODULE
+
+#include <algorithm>
+#include <string>
+#include <map>
+
+#include "Engine/Engine_systemc.hpp"
+
+using namespace aff3ct;
+
+Engine_systemc
+::Engine_systemc(const tools::Chain::parameters &params, const bool stats)
+: Engine(params, stats),
+  chain(new tools::Chain(params, this->monitor, 0, stats)),
+  is_interrupt([]() { return false; }),
+  started(false)
+{
+	// position of the sockets of the stages: module, task id and socket id in the task
+	struct position { module::Module *module; int task; int socket; };
+	std::map<const module::Socket*, position> positions;
+
+	// create "sc_core::sc_module" instances for each task
+	for (auto &s : this->chain->get_stages())
+	{
+		auto &tasks = s.module->tasks;
+		const auto t = (int)(std::find_if(tasks.begin(), tasks.end(), [&s](const std::shared_ptr<module::Task> &tsk)
+		                                  { return tsk.get() == s.task; }) - tasks.begin());
+		s.module->sc.create_module(t);
+
+		for (size_t k = 0; k < s.task->sockets.size(); k++)
+			positions[s.task->sockets[k].get()] = { s.module, t, (int)k };
+	}
+
+	// the consumers of each output socket
+	std::map<const module::Socket*, std::vector<const module::Socket*>> consumers;
+	std::vector<const module::Socket*> producers; // in the order of the chain
+	for (auto &b : this->chain->get_bindings())
+	{
+		if (!consumers.count(b.out))
+			producers.push_back(b.out);
+		consumers[b.out].push_back(b.in);
+	}
+
+	// bind the sockets between the modules
+	for (auto out : producers)
+	{
+		auto &o = positions.at(out);
+		auto &s_out = o.module->sc[o.task].s_out[o.socket];
+		auto &ins = consumers[out];
+		if (ins.size() == 1)
+		{
+			auto &i = positions.at(ins[0]);
+			s_out(i.module->sc[i.task].s_in[i.socket]);
+		}
+		else
+		{
+			// declare a SystemC fan-out to send the output to all the consumers
+			const auto name = "SC_Fanout_" + std::to_string(this->fanouts.size());
+			this->fanouts.push_back(std::unique_ptr<tools::SC_Fanout>(new tools::SC_Fanout(ins.size(),
+			                                                                               name.c_str())));
+			auto &fanout = *this->fanouts.back();
+			s_out(fanout.s_in);
+			for (size_t c = 0; c < ins.size(); c++)
+			{
+				auto &i = positions.at(ins[c]);
+				fanout.s_out[c](i.module->sc[i.task].s_in[i.socket]);
+			}
+		}
+	}
+
+	// pause the SystemC simulation at the end of an SNR point, the simulation context and the SystemC graph are kept
+	// and the simulation is resumed by the next "sc_core::sc_start()" call
+	this->monitor->add_handler_check([this]() -> void
+	{
+		if (this->is_done(this->is_interrupt))
+			sc_core::sc_pause();
+	});
+
+	sc_core::sc_report_handler::set_actions(sc_core::SC_INFO, sc_core::SC_DO_NOTHING);
+}
+
+Engine_systemc
+::~Engine_systemc()
+{
+	// end the paused SystemC simulation
+	if (this->started)
+		sc_core::sc_stop();
+}
+
+std::string Engine_systemc
+::get_name() const
+{
+	return "SYSTEMC";
+}
+
+module::Monitor_BFER<>& Engine_systemc
+::get_monitor()
+{
+	return *this->monitor;
+}
+
+std::vector<tools::Chain*> Engine_systemc
+::get_chains()
+{
+	return { this->chain.get() };
+}
+
+void Engine_systemc
+::set_noise(const tools::Sigma<> &noise)
+{
+	this->chain->set_noise(noise);
+}
+
+void Engine_systemc
+::run(const std::function<bool()> &is_interrupt)
+{
+	this->is_interrupt = is_interrupt;
+
+	// start (or resume) the SystemC simulation
+	this->started = true;
+	sc_core::sc_start();
+}
+
+void Engine_systemc
+::reset()
+{
+	this->monitor->reset();
+}
+
+std::vector<Engine::stage_stats> Engine_systemc
+::get_stats() const
+{
+	return this->sum_stats({ this->chain.get() });
+}
+
+#endif /* AFF3CT_SYSTEMC_MODULE */
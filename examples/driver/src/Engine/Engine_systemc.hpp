@@ -0,0 +1,47 @@
+#ifndef ENGINE_SYSTEMC_HPP_
+#define ENGINE_SYSTEMC_HPP_
+
+#ifdef AFF3CT_SYSTEMC_MODULE
+
+#include <memory>
+#include <vector>
+
+#include "SC_Fanout.hpp"
+
+#include "Engine/Engine.hpp"
+
+// a single chain executed by the SystemC simulation kernel (like the 'systemc' example): each stage is a SystemC module
+// and the sockets bound in the chain are bound with TLM sockets (a fan-out shares an output read by several stages).
+// The graph is built once, the simulation is paused by the monitor at the end of an SNR point and resumed for the next
+// one. Requires AFF3CT compiled with the SystemC module ('AFF3CT_SYSTEMC_MODULE')
+class Engine_systemc : public Engine
+{
+protected:
+	std::unique_ptr<aff3ct::module::Monitor_BFER<>>        monitor;
+	std::unique_ptr<aff3ct::tools::Chain>                  chain;
+	std::vector<std::unique_ptr<aff3ct::tools::SC_Fanout>> fanouts;
+	std::function<bool()>                                  is_interrupt; // of the current SNR point
+	bool                                                   started;
+
+public:
+	Engine_systemc(const aff3ct::tools::Chain::parameters &params, const bool stats);
+	virtual ~Engine_systemc();
+
+	std::string get_name() const;
+
+	aff3ct::module::Monitor_BFER<>& get_monitor();
+
+	std::vector<aff3ct::tools::Chain*> get_chains();
+
+	void set_noise(const aff3ct::tools::Sigma<> &noise);
+
+	void run(const std::function<bool()> &is_interrupt);
+
+	void reset();
+
+	std::vector<stage_stats> get_stats() const;
+};
+
+#endif /* AFF3CT_SYSTEMC_MODULE */
+
+#endif /* ENGINE_SYSTEMC_HPP_ */
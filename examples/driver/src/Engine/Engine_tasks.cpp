@@ -0,0 +1,59 @@
+#include "Engine/Engine_tasks.hpp"
+
+using namespace aff3ct;
+
+Engine_tasks
+::Engine_tasks(const tools::Chain::parameters &params, const bool stats)
+: Engine_tasks(params, stats, stats)
+{
+}
+
+Engine_tasks
+::Engine_tasks(const tools::Chain::parameters &params, const bool stats, const bool task_stats)
+: Engine(params, stats),
+  chain(new tools::Chain(params, this->monitor, 0, task_stats))
+{
+}
+
+std::string Engine_tasks
+::get_name() const
+{
+	return "TASKS";
+}
+
+module::Monitor_BFER<>& Engine_tasks
+::get_monitor()
+{
+	return *this->monitor;
+}
+
+std::vector<tools::Chain*> Engine_tasks
+::get_chains()
+{
+	return { this->chain.get() };
+}
+
+void Engine_tasks
+::set_noise(const tools::Sigma<> &noise)
+{
+	this->chain->set_noise(noise);
+}
+
+void Engine_tasks
+::run(const std::function<bool()> &is_interrupt)
+{
+	while (!this->is_done(is_interrupt))
+		this->chain->exec();
+}
+
+void Engine_tasks
+::reset()
+{
+	this->monitor->reset();
+}
+
+std::vector<Engine::stage_stats> Engine_tasks
+::get_stats() const
+{
+	return this->sum_stats({ this->chain.get() });
+}
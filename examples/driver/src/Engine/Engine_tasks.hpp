@@ -0,0 +1,39 @@
+#ifndef ENGINE_TASKS_HPP_
+#define ENGINE_TASKS_HPP_
+
+#include <memory>
+
+#include "Engine/Engine.hpp"
+
+// a single chain, the tasks of the stages are executed one after the other ('Task::exec', like the 'tasks' example)
+class Engine_tasks : public Engine
+{
+protected:
+	std::unique_ptr<aff3ct::module::Monitor_BFER<>> monitor;
+	std::unique_ptr<aff3ct::tools::Chain>           chain;
+
+public:
+	Engine_tasks(const aff3ct::tools::Chain::parameters &params, const bool stats);
+	virtual ~Engine_tasks() = default;
+
+protected:
+	// 'task_stats' enables the statistics of the tasks (= 'stats' when the engine executes the tasks)
+	Engine_tasks(const aff3ct::tools::Chain::parameters &params, const bool stats, const bool task_stats);
+
+public:
+	virtual std::string get_name() const;
+
+	aff3ct::module::Monitor_BFER<>& get_monitor();
+
+	std::vector<aff3ct::tools::Chain*> get_chains();
+
+	void set_noise(const aff3ct::tools::Sigma<> &noise);
+
+	virtual void run(const std::function<bool()> &is_interrupt);
+
+	void reset();
+
+	virtual std::vector<stage_stats> get_stats() const;
+};
+
+#endif /* ENGINE_TASKS_HPP_ */
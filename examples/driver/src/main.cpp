@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <cctype>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include <aff3ct.hpp>
+using namespace aff3ct;
+
+#include "Factory/Engine/Engine.hpp"
+#include "Factory/Terminal/Terminal_extended.hpp"
+#include "Engine/Engine_direct.hpp"
+#include "Engine/Engine_omp.hpp"
+#include "Engine/Engine_pipeline.hpp"
+#include "Engine/Engine_systemc.hpp"
+#include "Engine/Engine_tasks.hpp"
+#include "Tools/Chain/Chain.hpp"
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+#include "Tools/Terminal/Reporter_snapshot.hpp"
+
+struct params
+{
+	float ebn0_min  =  0.00f; // minimum SNR value
+	float ebn0_max  = 10.01f; // maximum SNR value
+	float ebn0_step =  1.00f; // SNR step
+	float R;                  // code rate (R=K/N)
+
+	tools::Chain::parameters                                chain; // modules of the chain (same for all the engines)
+	std::unique_ptr<factory::Engine           ::parameters> engine;
+	std::unique_ptr<factory::Terminal_extended::parameters> terminal;
+};
+void init_params(int argc, char** argv, params &p);
+
+struct utils
+{
+	std::unique_ptr<Engine>                               engine;    // build the chain(s) and execute the stages
+	std::unique_ptr<tools::Sigma<>>                       noise;     // a sigma noise type
+	std::vector<std::unique_ptr<tools::Monitor_snapshot>> snapshots; // counters of the monitors of the chains (or none)
+	std::vector<std::unique_ptr<tools::Reporter>>         reporters; // list of reporters dispayed in the terminal
+	std::unique_ptr<tools::Terminal>                      terminal;  // manage the output text in the terminal
+};
+void init_utils(const params &p, utils &u);
+
+// the SystemC kernel provides the 'main' function when the SystemC engine is available
+#ifdef AFF3CT_SYSTEMC_MODULE
+int sc_main(int argc, char** argv)
+#else
+int main(int argc, char** argv)
+#endif
+{
+	// get the AFF3CT version
+	const std::string v = "v" + std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "# This is a basic program using the AFF3CT library (" << v << ")" << std::endl;
+	std::cout << "# Feel free to improve it as you want to fit your needs."         << std::endl;
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "#"                                                                << std::endl;
+
+	params p; init_params(argc, argv, p); // create and initialize the parameters from the command line with factories
+	utils  u;
+	try
+	{
+		init_utils(p, u); // create the engine (= build the chain) and the utils
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// display the legend in the terminal
+	u.terminal->legend();
+
+	// loop over the various SNRs
+	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
+	{
+		// compute the current sigma for the channel noise
+		const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
+		const auto sigma = tools::esn0_to_sigma(esn0     );
+
+		u.noise->set_noise(sigma, ebn0, esn0);
+
+		// update the sigma of the modules of the chain(s)
+		u.engine->set_noise(*u.noise);
+
+		// display the performance (BER and FER) in real time (in a separate thread)
+		for (auto &s : u.snapshots)
+			s->reset();
+		u.terminal->start_temp_report();
+
+		// run the simulation chain with the selected engine
+		auto terminal = u.terminal.get();
+		u.engine->run([terminal]() { return terminal->is_interrupt(); });
+
+		// display the performance (BER and FER) in the terminal
+		u.terminal->final_report();
+
+		// reset the monitor(s) and the terminal for the next SNR
+		u.engine->reset();
+		u.terminal->reset();
+
+		// if user pressed Ctrl+c twice, exit the SNRs loop
+		if (u.terminal->is_over()) break;
+	}
+
+	// display the statistics of the stages (if enabled), in the same format for all the engines
+	std::cout << "#" << std::endl;
+	u.engine->show_stats(std::cout);
+	std::cout << "# End of the simulation" << std::endl;
+
+	return 0;
+}
+
+void init_params(int argc, char** argv, params &p)
+{
+	auto &c = p.chain;
+	c.source   = std::unique_ptr<factory::Source           ::parameters>(new factory::Source           ::parameters());
+	c.family   = std::unique_ptr<factory::Codec_generic    ::parameters>(new factory::Codec_generic    ::parameters());
+	c.family->pre_parse(argc, argv); // the parameters of the codec depend on its family
+	c.codec    = std::unique_ptr<factory::Codec_SIHO       ::parameters>(c.family->make_codec());
+	c.modem    = std::unique_ptr<factory::Modem_extended   ::parameters>(new factory::Modem_extended   ::parameters());
+	c.channel  = std::unique_ptr<factory::Channel_extended ::parameters>(new factory::Channel_extended ::parameters());
+	c.monitor  = std::unique_ptr<factory::Monitor_BFER     ::parameters>(new factory::Monitor_BFER     ::parameters());
+	p.engine   = std::unique_ptr<factory::Engine           ::parameters>(new factory::Engine           ::parameters());
+	p.terminal = std::unique_ptr<factory::Terminal_extended::parameters>(new factory::Terminal_extended::parameters());
+
+	std::vector<factory::Factory::parameters*> params_list = { c.source .get(), c.family .get(), c.codec   .get(),
+	                                                           c.modem  .get(), c.channel.get(), c.monitor .get(),
+	                                                           p.engine .get(), p.terminal.get()                  };
+
+	// the inter-frame SIMD mode sets the number of frames of the modules and the SIMD strategy of the decoder
+	std::vector<std::string> args(argv, argv + argc);
+	c.family->complete_args(args, *c.codec, params_list);
+
+	// '--engine=omp' is the same as '--engine OMP'
+	for (size_t a = 1; a < args.size(); a++)
+	{
+		const std::string opt = "--engine=";
+		if (args[a].compare(0, opt.size(), opt) == 0)
+		{
+			args.insert(args.begin() + a +1, args[a].substr(opt.size()));
+			args[a] = "--engine";
+		}
+		if ((args[a] == "--engine" || args[a] == "--eng-type") && a +1 < args.size())
+			std::transform(args[a +1].begin(), args[a +1].end(), args[a +1].begin(), ::toupper);
+	}
+
+	std::vector<char*> args_ptr;
+	for (auto &a : args)
+		args_ptr.push_back(const_cast<char*>(a.c_str()));
+
+	// parse the command for the given parameters and fill them
+	factory::Command_parser cp((int)args_ptr.size(), args_ptr.data(), params_list, true);
+	if (cp.parsing_failed())
+	{
+		cp.print_help    ();
+		cp.print_warnings();
+		cp.print_errors  ();
+		std::exit(1);
+	}
+
+	// the channel transmits the modulated frames (real and imaginary parts of the symbols for the complex modulations)
+	c.channel->N       = c.modem->N_mod;
+	c.channel->complex = c.modem->complex;
+
+	std::cout << "# Simulation parameters: " << std::endl;
+	factory::Header::print_parameters(params_list); // display the headers (= print the AFF3CT parameters on the screen)
+	std::cout << "#" << std::endl;
+	cp.print_warnings();
+
+	p.R = (float)c.codec->enc->K / (float)c.codec->enc->N_cw; // compute the code rate
+}
+
+void init_utils(const params &p, utils &u)
+{
+	// the engine builds the chain (one chain per thread for the 'OMP' engine)
+	const auto &e = *p.engine;
+	if (e.type == "DIRECT")
+		u.engine = std::unique_ptr<Engine>(new Engine_direct  (p.chain, e.stats));
+	else if (e.type == "TASKS")
+		u.engine = std::unique_ptr<Engine>(new Engine_tasks   (p.chain, e.stats));
+	else if (e.type == "OMP")
+		u.engine = std::unique_ptr<Engine>(new Engine_omp     (p.chain, e.stats, e.n_threads));
+	else if (e.type == "PIPELINE")
+		u.engine = std::unique_ptr<Engine>(new Engine_pipeline(p.chain, e.stats, (size_t)e.depth));
+#ifdef AFF3CT_SYSTEMC_MODULE
+	else if (e.type == "SYSTEMC")
+		u.engine = std::unique_ptr<Engine>(new Engine_systemc (p.chain, e.stats));
+#endif
+	else
+	{
+		std::stringstream message;
+		message << "The '" << e.type << "' engine is not available in this build ('SYSTEMC' requires AFF3CT compiled "
+		        << "with the SystemC module).";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// create a sigma noise type
+	u.noise = std::unique_ptr<tools::Sigma<>>(new tools::Sigma<>());
+	// report the noise values (Es/N0 and Eb/N0)
+	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_noise<>(*u.noise)));
+	if (p.terminal->use_snapshots())
+	{
+		// the monitor of each chain publishes its counters after each check (in the thread that executes the check),
+		// the reporting thread only reads the snapshots
+		std::vector<const tools::Monitor_snapshot*> snapshots;
+		for (auto chain : u.engine->get_chains())
+		{
+			u.snapshots.push_back(std::unique_ptr<tools::Monitor_snapshot>(new tools::Monitor_snapshot()));
+			auto monitor  = &chain->get_monitor();
+			auto snapshot = u.snapshots.back().get();
+			monitor->add_handler_check([monitor, snapshot]()
+			{
+				snapshot->publish(monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe());
+			});
+			snapshots.push_back(snapshot);
+		}
+		// report the bit/frame error rates and the simulation throughputs (sum of the snapshots of the chains)
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_snapshot(snapshots,
+		                                                                                    p.chain.codec->enc->K)));
+	}
+	else
+	{
+		// report the bit/frame error rates
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_BFER<>(u.engine->get_monitor())));
+		// report the simulation throughputs
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(
+			u.engine->get_monitor())));
+	}
+	// create a terminal that will display the collected data from the reporters
+	u.terminal = std::unique_ptr<tools::Terminal>(p.terminal->build(u.reporters, u.noise.get()));
+}
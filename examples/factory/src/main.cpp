@@ -1,14 +1,42 @@
 #include <functional>
+#include <algorithm>
 #include <exception>
 #include <iostream>
+#include <fstream>
+#include <numeric>
 #include <cstdlib>
+#include <cstdint>
+#include <csignal>
+#include <iomanip>
+#include <sstream>
 #include <memory>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
 
 #include <aff3ct.hpp>
 using namespace aff3ct;
 
+#include "Factory/Checkpoint/Checkpoint.hpp"
+#include "Factory/Metrics/Metrics.hpp"
+#include "Factory/Result_store/Result_store.hpp"
+#include "Factory/Sweep/Sweep.hpp"
+#include "Factory/Terminal/Terminal_extended.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_ring.hpp"
+#include "Tools/Chain/Chain.hpp"
+#include "Tools/Checkpoint/Checkpointer.hpp"
+#include "Tools/Metrics/Metrics_exporter.hpp"
+#include "Tools/Parameters/Parameters_args.hpp"
+#include "Tools/Parameters/Parameters_key.hpp"
+#include "Tools/Stats/Stats_reduction.hpp"
+#include "Tools/Store/Result_store.hpp"
+#include "Tools/Sweep/Sweep_plan.hpp"
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+#include "Tools/Terminal/Reporter_snapshot.hpp"
+
 struct params
 {
 	float ebn0_min  =  0.00f; // minimum SNR value
@@ -16,35 +44,54 @@ struct params
 	float ebn0_step =  1.00f; // SNR step
 	float R;                  // code rate (R=K/N)
 
-	std::unique_ptr<factory::Source          ::parameters> source;
-	std::unique_ptr<factory::Codec_repetition::parameters> codec;
-	std::unique_ptr<factory::Modem           ::parameters> modem;
-	std::unique_ptr<factory::Channel         ::parameters> channel;
-	std::unique_ptr<factory::Monitor_BFER    ::parameters> monitor;
-	std::unique_ptr<factory::Terminal        ::parameters> terminal;
+	tools::Chain::parameters                                chain; // the modules of the simulation chain
+	std::unique_ptr<factory::Terminal_extended::parameters> terminal;
+	std::unique_ptr<factory::Sweep            ::parameters> sweep;
+	std::unique_ptr<factory::Result_store     ::parameters> store;
+	std::unique_ptr<factory::Checkpoint       ::parameters> checkpoint;
+	std::unique_ptr<factory::Metrics          ::parameters> metrics;
 };
-void init_params(int argc, char** argv, params &p);
-
-struct modules
-{
-	std::unique_ptr<module::Source<>>       source;
-	std::unique_ptr<module::Codec_SIHO<>>   codec;
-	std::unique_ptr<module::Modem<>>        modem;
-	std::unique_ptr<module::Channel<>>      channel;
-	std::unique_ptr<module::Monitor_BFER<>> monitor;
-	                module::Encoder<>*      encoder;
-	                module::Decoder_SIHO<>* decoder;
-	std::vector<const module::Module*>      list; // list of module pointers declared in this structure
-};
-void init_modules(const params &p, modules &m);
+void init_params(int argc, char** argv, params &p, const bool display = true);
+uint64_t result_key(const params &p); // identify the simulated system in the result store
 
 struct utils
 {
 	std::unique_ptr<tools::Sigma<>>               noise;     // a sigma noise type
 	std::vector<std::unique_ptr<tools::Reporter>> reporters; // list of reporters dispayed in the terminal
 	std::unique_ptr<tools::Terminal>              terminal;  // manage the output text in the terminal
+	std::unique_ptr<tools::Monitor_snapshot>      snapshot;  // counters of the monitor for the reporters (can be null)
+	std::unique_ptr<tools::Result_store>          store;     // results of the previous simulations (can be null)
+	std::unique_ptr<tools::Checkpointer>          ckp;       // periodic save of the simulation state (can be null)
+	std::unique_ptr<tools::Stats_reduction>       stats;     // statistics of the tasks for the metrics (can be null)
+	std::unique_ptr<tools::Metrics_exporter>      metrics;   // serve the live metrics (can be null)
+};
+void init_utils(const params &p, const tools::Chain &chain, utils &u);
+
+// simulate the current SNR point: execute the chain until 'is_done' returns true, 'on_exec' is called after each
+// execution of the simulation loop (can be empty)
+void run_point(tools::Chain &chain, const std::function<bool()> &is_done,
+               const std::function<void()> &on_exec = nullptr);
+
+// performance of one SNR point of a sweep job
+struct sweep_point
+{
+	size_t             job;
+	float              ebn0;
+	float              esn0;
+	int                K;
+	unsigned long long n_fra;
+	unsigned long long n_be;
+	unsigned long long n_fe;
+	double             time; // simulation time of the SNR point (in seconds)
 };
-void init_utils(const params &p, const modules &m, utils &u);
+int  run_sweep(int argc, char** argv, const params &p);
+bool lookup   (const params &p, const tools::Result_store *store, const size_t job, std::vector<sweep_point> &points);
+void simulate (const params &p, tools::Chain &chain, tools::Result_store *store, const size_t job,
+               std::vector<sweep_point> &points);
+
+// set by Ctrl+C during a sweep (there is no terminal): the running jobs stop and the next ones are not started
+std::atomic<bool> sweep_interrupt(false);
+void sweep_interrupt_handler(int) { sweep_interrupt = true; }
 
 int main(int argc, char** argv)
 {
@@ -59,57 +106,128 @@ int main(int argc, char** argv)
 	std::cout << "#----------------------------------------------------------"      << std::endl;
 	std::cout << "#"                                                                << std::endl;
 
-	params  p; init_params (argc, argv, p); // create and initialize the parameters from the command line with factories
-	modules m; init_modules(p, m         ); // create and initialize the modules
-	utils   u; init_utils  (p, m, u      ); // create and initialize the utils
+	params p; init_params(argc, argv, p); // create and initialize the parameters from the command line with factories
+
+	// run one simulation per combination of the swept parameters instead of a single simulation
+	if (p.sweep->is_enabled())
+		return run_sweep(argc, argv, p);
+
+	// create the modules and bind their sockets (connect the sockets of the tasks = fill the input sockets with the
+	// output sockets)
+	std::unique_ptr<module::Monitor_BFER<>> monitor;
+	tools::Chain chain(p.chain, monitor);
+	utils u; init_utils(p, chain, u); // create and initialize the utils
+	const auto key = result_key(p);
 
 	// display the legend in the terminal
 	u.terminal->legend();
 
-	// sockets binding (connect the sockets of the tasks = fill the input sockets with the output sockets)
-	using namespace module;
-	(*m.encoder)[enc::sck::encode      ::U_K ].bind((*m.source )[src::sck::generate   ::U_K ]);
-	(*m.modem  )[mdm::sck::modulate    ::X_N1].bind((*m.encoder)[enc::sck::encode     ::X_N ]);
-	(*m.channel)[chn::sck::add_noise   ::X_N ].bind((*m.modem  )[mdm::sck::modulate   ::X_N2]);
-	(*m.modem  )[mdm::sck::demodulate  ::Y_N1].bind((*m.channel)[chn::sck::add_noise  ::Y_N ]);
-	(*m.decoder)[dec::sck::decode_siho ::Y_N ].bind((*m.modem  )[mdm::sck::demodulate ::Y_N2]);
-	(*m.monitor)[mnt::sck::check_errors::U   ].bind((*m.encoder)[enc::sck::encode     ::U_K ]);
-	(*m.monitor)[mnt::sck::check_errors::V   ].bind((*m.decoder)[dec::sck::decode_siho::V_K ]);
+	// state of the interrupted simulation to continue
+	tools::Checkpointer::State resumed = { key, 0, 0, 0, 0, 0, 0. };
+	const bool resume = u.ckp && p.checkpoint->resume && u.ckp->load(key, resumed);
+	if (resume)
+		std::cout << "# Resume the simulation from the SNR point " << resumed.snr_idx << " (" << resumed.n_fra
+		          << " frames already simulated)" << std::endl;
+
+	// with checkpoints, the PRNGs are reseeded at the beginning of each epoch (see 'tools::Checkpointer')
+	auto reseed = [&p, &chain](const uint32_t snr_idx, const uint32_t epoch)
+	{
+		chain.set_seeds(tools::Checkpointer::make_seed(p.chain.source ->seed, snr_idx, epoch),
+		                tools::Checkpointer::make_seed(p.chain.channel->seed, snr_idx, epoch));
+	};
 
 	// loop over the various SNRs
-	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
+	uint32_t snr_idx = 0;
+	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step, snr_idx++)
 	{
+		// the SNR points before the checkpoint are over
+		if (resume && snr_idx < resumed.snr_idx)
+			continue;
+
+		// skip the SNR points that were already simulated with the same parameters
+		tools::Result_store::Point stored;
+		if (u.store && p.store->lookup && u.store->find(key, ebn0, stored))
+		{
+			tools::Result_store::display(std::cout, ebn0, p.chain.codec->enc->K, stored);
+			continue;
+		}
+
 		// compute the current sigma for the channel noise
 		const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
 		const auto sigma = tools::esn0_to_sigma(esn0     );
 
 		u.noise->set_noise(sigma, ebn0, esn0);
 
-		// update the sigma of the modem and the channel
-		m.codec  ->set_noise(*u.noise);
-		m.modem  ->set_noise(*u.noise);
-		m.channel->set_noise(*u.noise);
+		// update the sigma of the modules of the chain
+		chain.set_noise(*u.noise);
+		if (u.metrics) u.metrics->set_ebn0(ebn0);
+
+		// restore the monitor counters of the checkpoint and continue with the next epoch
+		uint32_t epoch     = 0;
+		double   time_prev = 0.;
+		if (resume && snr_idx == resumed.snr_idx)
+		{
+			module::Monitor_BFER<>::Attributes restored;
+			restored.n_fra = resumed.n_fra;
+			restored.n_be  = resumed.n_be;
+			restored.n_fe  = resumed.n_fe;
+			monitor->collect(restored);
+			epoch     = resumed.epoch +1;
+			time_prev = resumed.time;
+		}
+		if (u.ckp)
+			reseed(snr_idx, epoch);
+
+		// new start time of the snapshot, with the counters restored from the checkpoint (if any)
+		if (u.snapshot)
+		{
+			u.snapshot->reset();
+			u.snapshot->publish(monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe());
+		}
 
 		// display the performance (BER and FER) in real time (in a separate thread)
 		u.terminal->start_temp_report();
+		const auto t_start = std::chrono::steady_clock::now();
 
-		// run the simulation chain
-		while (!m.monitor->fe_limit_achieved() && !u.terminal->is_interrupt())
+		// current state of the simulation, for the checkpoints
+		auto state = [&](const uint32_t idx, const uint32_t e) -> tools::Checkpointer::State
 		{
-			(*m.source )[src::tsk::generate    ].exec();
-			(*m.encoder)[enc::tsk::encode      ].exec();
-			(*m.modem  )[mdm::tsk::modulate    ].exec();
-			(*m.channel)[chn::tsk::add_noise   ].exec();
-			(*m.modem  )[mdm::tsk::demodulate  ].exec();
-			(*m.decoder)[dec::tsk::decode_siho ].exec();
-			(*m.monitor)[mnt::tsk::check_errors].exec();
-		}
+			return { key, idx, e, monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe(),
+			         time_prev + std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count() };
+		};
+
+		// run the simulation chain
+		auto is_done = [&monitor, &u]() { return monitor->fe_limit_achieved() || u.terminal->is_interrupt(); };
+		if (u.ckp)
+			run_point(chain, is_done, [&]()
+			{
+				// end of the epoch: copy the state for the writer thread and start a new epoch
+				if (u.ckp->is_due())
+				{
+					u.ckp->save(state(snr_idx, epoch));
+					reseed(snr_idx, ++epoch);
+				}
+			});
+		else
+			run_point(chain, is_done);
 
 		// display the performance (BER and FER) in the terminal
 		u.terminal->final_report();
 
+		// an interrupted SNR point continues from its last frame, a finished one from the next SNR point
+		if (u.ckp)
+		{
+			if (u.terminal->is_interrupt()) u.ckp->save(state(snr_idx, epoch));
+			else                            u.ckp->save({ key, snr_idx +1, 0, 0, 0, 0, 0. });
+		}
+
+		// append the SNR point to the result store (an interrupted point is not complete)
+		if (u.store && !u.terminal->is_interrupt())
+			u.store->store(key, ebn0, { monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe(),
+			                            state(snr_idx, epoch).time });
+
 		// reset the monitor and the terminal for the next SNR
-		m.monitor->reset();
+		monitor->reset();
 		u.terminal->reset();
 
 		// if user pressed Ctrl+c twice, exit the SNRs loop
@@ -118,91 +236,367 @@ int main(int argc, char** argv)
 
 	// display the statistics of the tasks (if enabled)
 	std::cout << "#" << std::endl;
-	tools::Stats::show(m.list, true);
+	tools::Stats::show(std::vector<const module::Module*>(chain.get_modules().begin(), chain.get_modules().end()),
+	                   true);
+	// the frames that waited for their noise (add producers with '--chn-ring-producers' when it is not small)
+	if (auto ring = dynamic_cast<const module::Channel_AWGN_LLR_ring<>*>(&chain.get_channel()))
+		std::cout << "# Noise ring stalls: " << ring->get_n_stalls() << std::endl;
 	std::cout << "# End of the simulation" << std::endl;
 
 	return 0;
 }
 
-void init_params(int argc, char** argv, params &p)
+void init_params(int argc, char** argv, params &p, const bool display)
 {
-	p.source   = std::unique_ptr<factory::Source          ::parameters>(new factory::Source          ::parameters());
-	p.codec    = std::unique_ptr<factory::Codec_repetition::parameters>(new factory::Codec_repetition::parameters());
-	p.modem    = std::unique_ptr<factory::Modem           ::parameters>(new factory::Modem           ::parameters());
-	p.channel  = std::unique_ptr<factory::Channel         ::parameters>(new factory::Channel         ::parameters());
-	p.monitor  = std::unique_ptr<factory::Monitor_BFER    ::parameters>(new factory::Monitor_BFER    ::parameters());
-	p.terminal = std::unique_ptr<factory::Terminal        ::parameters>(new factory::Terminal        ::parameters());
-
-	std::vector<factory::Factory::parameters*> params_list = { p.source .get(), p.codec  .get(), p.modem   .get(),
-	                                                           p.channel.get(), p.monitor.get(), p.terminal.get() };
+	auto &c = p.chain;
+	c.source   = std::unique_ptr<factory::Source           ::parameters>(new factory::Source           ::parameters());
+	c.family   = std::unique_ptr<factory::Codec_generic    ::parameters>(new factory::Codec_generic    ::parameters());
+	c.family->pre_parse(argc, argv); // the parameters of the codec depend on its family
+	c.codec    = std::unique_ptr<factory::Codec_SIHO       ::parameters>(c.family->make_codec());
+	c.modem    = std::unique_ptr<factory::Modem_extended   ::parameters>(new factory::Modem_extended   ::parameters());
+	c.channel  = std::unique_ptr<factory::Channel_extended ::parameters>(new factory::Channel_extended ::parameters());
+	c.monitor  = std::unique_ptr<factory::Monitor_BFER     ::parameters>(new factory::Monitor_BFER     ::parameters());
+	p.terminal = std::unique_ptr<factory::Terminal_extended::parameters>(new factory::Terminal_extended::parameters());
+	p.sweep    = std::unique_ptr<factory::Sweep            ::parameters>(new factory::Sweep            ::parameters());
+	p.store    = std::unique_ptr<factory::Result_store     ::parameters>(new factory::Result_store     ::parameters());
+	p.checkpoint = std::unique_ptr<factory::Checkpoint::parameters>(new factory::Checkpoint::parameters());
+	p.metrics  = std::unique_ptr<factory::Metrics          ::parameters>(new factory::Metrics          ::parameters());
+
+	std::vector<factory::Factory::parameters*> params_list = { c.source  .get(), c.family .get(), c.codec  .get(),
+	                                                           c.modem   .get(), c.channel.get(), c.monitor.get(),
+	                                                           p.terminal.get(), p.sweep  .get(), p.store  .get(),
+	                                                           p.checkpoint.get(), p.metrics.get()                };
+
+	// the inter-frame SIMD mode sets the number of frames of the modules and the SIMD strategy of the decoder
+	std::vector<std::string> args(argv, argv + argc);
+	c.family->complete_args(args, *c.codec, params_list);
+	std::vector<char*> args_ptr;
+	for (auto &a : args)
+		args_ptr.push_back(const_cast<char*>(a.c_str()));
 
 	// parse the command for the given parameters and fill them
-	factory::Command_parser cp(argc, argv, params_list, true);
+	factory::Command_parser cp((int)args_ptr.size(), args_ptr.data(), params_list, true);
 	if (cp.parsing_failed())
 	{
-		cp.print_help    ();
+		if (display) cp.print_help();
 		cp.print_warnings();
 		cp.print_errors  ();
 		std::exit(1);
 	}
 
-	std::cout << "# Simulation parameters: " << std::endl;
-	factory::Header::print_parameters(params_list); // display the headers (= print the AFF3CT parameters on the screen)
-	std::cout << "#" << std::endl;
-	cp.print_warnings();
+	// the channel transmits the modulated frames (real and imaginary parts of the symbols for the complex modulations)
+	c.channel->N       = c.modem->N_mod;
+	c.channel->complex = c.modem->complex;
+
+	if (display)
+	{
+		std::cout << "# Simulation parameters: " << std::endl;
+		factory::Header::print_parameters(params_list); // display the headers (= print the AFF3CT parameters)
+		std::cout << "#" << std::endl;
+		cp.print_warnings();
+	}
+
+	p.R = (float)c.codec->enc->K / (float)c.codec->enc->N_cw; // compute the code rate
+}
 
-	p.R = (float)p.codec->enc->K / (float)p.codec->enc->N_cw; // compute the code rate
+uint64_t result_key(const params &p)
+{
+	// only the parameters that change the results (not the terminal, the sweep or the store ones)
+	const auto &c = p.chain;
+	return tools::Result_store::make_key({ c.source.get(), c.codec.get(), c.modem.get(), c.channel.get(),
+	                                       c.monitor.get() });
 }
 
-void init_modules(const params &p, modules &m)
+void init_utils(const params &p, const tools::Chain &chain, utils &u)
 {
-	m.source  = std::unique_ptr<module::Source      <>>(p.source ->build());
-	m.codec   = std::unique_ptr<module::Codec_SIHO  <>>(p.codec  ->build());
-	m.modem   = std::unique_ptr<module::Modem       <>>(p.modem  ->build());
-	m.channel = std::unique_ptr<module::Channel     <>>(p.channel->build());
-	m.monitor = std::unique_ptr<module::Monitor_BFER<>>(p.monitor->build());
-	m.encoder = m.codec->get_encoder().get();
-	m.decoder = m.codec->get_decoder_siho().get();
-
-	m.list = { m.source.get(), m.modem.get(), m.channel.get(), m.monitor.get(), m.encoder, m.decoder };
-
-	// configuration of the module tasks
-	for (auto& mod : m.list)
-		for (auto& tsk : mod->tasks)
+	// create a sigma noise type
+	u.noise = std::unique_ptr<tools::Sigma<>>(new tools::Sigma<>());
+	// report the noise values (Es/N0 and Eb/N0)
+	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_noise<>(*u.noise)));
+	if (p.terminal->use_snapshots() || p.metrics->is_enabled())
+	{
+		// the monitor publishes its counters after each check, the reporting thread only reads the snapshot
+		u.snapshot = std::unique_ptr<tools::Monitor_snapshot>(new tools::Monitor_snapshot());
+		auto monitor  = &chain.get_monitor();
+		auto snapshot = u.snapshot.get();
+		monitor->add_handler_check([monitor, snapshot]()
+		{
+			snapshot->publish(monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe());
+		});
+	}
+	if (p.terminal->use_snapshots())
+	{
+		// report the bit/frame error rates and the simulation throughputs
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_snapshot({ u.snapshot.get() },
+		                                                                                    p.chain.codec->enc->K)));
+	}
+	else
+	{
+		// report the bit/frame error rates
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_BFER<>(chain.get_monitor())));
+		// report the simulation throughputs
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(chain.get_monitor())));
+	}
+	// create a terminal that will display the collected data from the reporters
+	u.terminal = std::unique_ptr<tools::Terminal>(p.terminal->build(u.reporters, u.noise.get()));
+	// open the store of the simulated SNR points
+	if (p.store->is_enabled())
+		u.store = std::unique_ptr<tools::Result_store>(p.store->build());
+	// save the state of the simulation periodically (the file is written by a background thread)
+	if (p.checkpoint->is_enabled())
+		u.ckp = std::unique_ptr<tools::Checkpointer>(p.checkpoint->build());
+	// serve the live metrics, the statistics of the tasks are collected every 'period' frames by the simulation
+	if (p.metrics->is_enabled())
+	{
+		std::vector<const module::Module*> list(chain.get_modules().begin(), chain.get_modules().end());
+		u.stats = std::unique_ptr<tools::Stats_reduction>(new tools::Stats_reduction(list, 1));
+		auto stats  = u.stats.get();
+		auto period = (uint64_t)p.metrics->period;
+		auto frames = (uint64_t)chain.get_monitor().get_n_frames(); // frames checked per call (SIMD width with '-F')
+		uint64_t n  = 0;
+		chain.get_monitor().add_handler_check([stats, list, period, frames, n]() mutable
 		{
-			tsk->set_autoalloc  (true ); // enable the automatic allocation of the data in the tasks
-			tsk->set_autoexec   (false); // disable the auto execution mode of the tasks
-			tsk->set_debug      (false); // disable the debug mode
-			tsk->set_debug_limit(16   ); // display only the 16 first bits if the debug mode is enabled
-			tsk->set_stats      (true ); // enable the statistics
-
-			// enable the fast mode (= disable the useless verifs in the tasks) if there is no debug and stats modes
-			if (!tsk->is_debug() && !tsk->is_stats())
-				tsk->set_fast(true);
+			n += frames;
+			if (n >= period)
+			{
+				n %= period;
+				stats->collect(0, list);
+			}
+		});
+		u.metrics = std::unique_ptr<tools::Metrics_exporter>(p.metrics->build({ u.snapshot.get() },
+		                                                                     p.chain.codec->enc->K, stats));
+	}
+}
+
+void run_point(tools::Chain &chain, const std::function<bool()> &is_done, const std::function<void()> &on_exec)
+{
+	// the stages out of the simulation loop (the all-zero codeword is generated, encoded and modulated only once)
+	chain.exec_once();
+
+	while (!is_done())
+	{
+		chain.exec_loop();
+		if (on_exec) on_exec();
+	}
+}
+
+int run_sweep(int argc, char** argv, const params &p)
+{
+	// the swept arguments replace all their spellings in the command lines of the jobs (e.g. '-K' and '--src-info-bits')
+	const auto &c = p.chain;
+	const std::vector<const factory::Factory::parameters*> params_list = { c.source  .get(), c.family .get(),
+	                                                                       c.codec   .get(), c.modem  .get(),
+	                                                                       c.channel .get(), c.monitor.get(),
+	                                                                       p.terminal.get(), p.store  .get(),
+	                                                                       p.checkpoint.get(), p.metrics.get() };
+	const tools::Sweep_plan plan(p.sweep->dimensions, [&params_list](const std::string &arg)
+	{
+		return tools::argument_aliases(params_list, arg);
+	});
+	const auto &dims   = plan.get_dimensions();
+	const auto  n_jobs = plan.get_n_jobs();
+
+	// the command line of a job = the command line of the sweep without the sweep arguments + the swept values
+	const auto base = tools::Sweep_plan::remove_args(std::vector<std::string>(argv +1, argv + argc),
+	                                                 "--" + p.sweep->get_prefix() + "-");
+
+	// parse the command lines of all the jobs before running them (the parser is not thread safe)
+	std::vector<params> jobs(n_jobs);
+	for (size_t j = 0; j < n_jobs; j++)
+	{
+		auto args = plan.get_args(j, base);
+		args.insert(args.begin(), argv[0]);
+		std::vector<char*> job_argv;
+		for (auto &a : args)
+			job_argv.push_back(const_cast<char*>(a.c_str()));
+		init_params((int)job_argv.size(), job_argv.data(), jobs[j], false);
+	}
+
+	// sort the jobs by modules (the most expensive to build first): the consecutive jobs of a worker share modules
+	std::vector<std::string> keys(n_jobs);
+	for (size_t j = 0; j < n_jobs; j++)
+		keys[j] = tools::parameters_key(*jobs[j].chain.codec  ) + tools::parameters_key(*jobs[j].chain.modem ) +
+		          tools::parameters_key(*jobs[j].chain.channel) + tools::parameters_key(*jobs[j].chain.source);
+	std::vector<size_t> order(n_jobs);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+	// the result store is shared by all the workers
+	std::unique_ptr<tools::Result_store> store(p.store->is_enabled() ? p.store->build() : nullptr);
+
+	const auto n_threads = std::min((size_t)p.sweep->n_threads, n_jobs);
+	std::cout << "# Sweep: " << n_jobs << " job(s) on " << n_threads << " worker(s)" << std::endl;
+	std::signal(SIGINT, sweep_interrupt_handler);
+
+	std::mutex               mtx; // protect the results and the standard output
+	std::vector<sweep_point> points;
+	size_t                   n_done = 0, n_failed = 0;
+	std::atomic<size_t>      next(0);
+	const auto               t_start = std::chrono::steady_clock::now();
+
+	auto worker = [&]()
+	{
+		// the modules of the chain of a worker are reused by its next jobs when their parameters do not change
+		std::unique_ptr<module::Monitor_BFER<>> monitor;
+		std::unique_ptr<tools::Chain>           chain;
+		while (true)
+		{
+			// guided scheduling: large chunks of consecutive jobs first (= reuse), smaller ones at the end (= balance)
+			const auto remaining = n_jobs - std::min(next.load(), n_jobs);
+			const auto chunk     = std::max((size_t)1, remaining / (2 * n_threads));
+			const auto first     = next.fetch_add(chunk);
+			if (first >= n_jobs || sweep_interrupt)
+				break;
+
+			for (auto o = first; o < std::min(first + chunk, n_jobs) && !sweep_interrupt; o++)
+			{
+				const auto j = order[o];
+				std::vector<sweep_point> job_points;
+				std::string error;
+				try
+				{
+					// a job whose SNR points are all stored does not build any module
+					if (!lookup(jobs[j], store.get(), j, job_points))
+					{
+						job_points.clear();
+						chain = std::unique_ptr<tools::Chain>(new tools::Chain(jobs[j].chain, monitor, 0, true,
+						                                                       chain.get()));
+						simulate(jobs[j], *chain, store.get(), j, job_points);
+					}
+				}
+				catch (const std::exception &e)
+				{
+					error = e.what();
+					chain.reset(); // the modules may be in an inconsistent state
+				}
+
+				std::lock_guard<std::mutex> lock(mtx);
+				points.insert(points.end(), job_points.begin(), job_points.end());
+				n_failed += error.empty() ? 0 : 1;
+				std::cout << "# Job " << std::setw(4) << ++n_done << "/" << n_jobs << (error.empty() ? " done" : " FAILED")
+				          << " (";
+				const auto values = plan.get_values(j);
+				for (size_t d = 0; d < dims.size(); d++)
+					std::cout << (d ? ", " : "") << dims[d].arg << " " << values[d];
+				std::cout << ")" << std::endl;
+				if (!error.empty())
+					std::cerr << error << std::endl;
+			}
 		}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t t = 0; t < n_threads; t++)
+		workers.push_back(std::thread(worker));
+	for (auto &w : workers)
+		w.join();
+
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
 
-	// reset the memory of the decoder after the end of each communication
-	m.monitor->add_handler_check(std::bind(&module::Decoder::reset, m.decoder));
+	// write the combined result file (one line per job and per SNR, in the order of the jobs)
+	std::sort(points.begin(), points.end(), [](const sweep_point &a, const sweep_point &b)
+	{
+		return a.job < b.job || (a.job == b.job && a.ebn0 < b.ebn0);
+	});
+
+	std::ofstream file(p.sweep->out_path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the result file ('out_path' = " << p.sweep->out_path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-	// initialize the interleaver if this code use an interleaver
-	try
+	file << "JOB";
+	for (auto &d : dims)
+		file << "," << d.arg;
+	file << ",EB/N0,ES/N0,FRA,BE,FE,BER,FER,THR (Mb/s),TIME (s)" << std::endl;
+	file.precision(6);
+	for (auto &pt : points)
 	{
-		auto& interleaver = m.codec->get_interleaver();
-		interleaver->init();
+		const auto values = plan.get_values(pt.job);
+		file << pt.job;
+		for (auto &v : values)
+			file << "," << v;
+		file << "," << pt.ebn0
+		     << "," << pt.esn0
+		     << "," << pt.n_fra
+		     << "," << pt.n_be
+		     << "," << pt.n_fe
+		     << "," << (pt.n_fra ? (double)pt.n_be / ((double)pt.n_fra * pt.K) : 0.)
+		     << "," << (pt.n_fra ? (double)pt.n_fe / (double)pt.n_fra : 0.)
+		     << "," << (pt.time > 0. ? (double)pt.n_fra * pt.K / pt.time * 1e-6 : 0.)
+		     << "," << pt.time << std::endl;
 	}
-	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+
+	std::cout << "#" << std::endl;
+	std::cout << "# Sweep results written in '" << p.sweep->out_path << "' (" << points.size() << " SNR points, "
+	          << n_failed << " failed job(s), " << elapsed << " s)" << std::endl;
+	std::cout << "# End of the sweep" << std::endl;
+
+	return n_failed ? 1 : 0;
 }
 
-void init_utils(const params &p, const modules &m, utils &u)
+bool lookup(const params &p, const tools::Result_store *store, const size_t job, std::vector<sweep_point> &points)
 {
-	// create a sigma noise type
-	u.noise = std::unique_ptr<tools::Sigma<>>(new tools::Sigma<>());
-	// report the noise values (Es/N0 and Eb/N0)
-	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_noise<>(*u.noise)));
-	// report the bit/frame error rates
-	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_BFER<>(*m.monitor)));
-	// report the simulation throughputs
-	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(*m.monitor)));
-	// create a terminal that will display the collected data from the reporters
-	u.terminal = std::unique_ptr<tools::Terminal>(p.terminal->build(u.reporters));
-}
\ No newline at end of file
+	if (!store || !p.store->lookup)
+		return false;
+
+	const auto key = result_key(p);
+	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
+	{
+		tools::Result_store::Point stored;
+		if (!store->find(key, ebn0, stored))
+			return false;
+
+		const auto esn0 = tools::ebn0_to_esn0(ebn0, p.R);
+		points.push_back({job, ebn0, esn0, p.chain.codec->enc->K, stored.n_fra, stored.n_be, stored.n_fe,
+		                  stored.time});
+	}
+	return true;
+}
+
+void simulate(const params &p, tools::Chain &chain, tools::Result_store *store, const size_t job,
+              std::vector<sweep_point> &points)
+{
+	auto &monitor = chain.get_monitor();
+	tools::Sigma<> noise;
+	const auto key = result_key(p);
+
+	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
+	{
+		const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
+		const auto sigma = tools::esn0_to_sigma(esn0     );
+
+		// the stored SNR points are not simulated again
+		tools::Result_store::Point stored;
+		if (store && p.store->lookup && store->find(key, ebn0, stored))
+		{
+			points.push_back({job, ebn0, esn0, p.chain.codec->enc->K, stored.n_fra, stored.n_be, stored.n_fe,
+			                  stored.time});
+			continue;
+		}
+
+		noise.set_noise(sigma, ebn0, esn0);
+		chain.set_noise(noise);
+
+		// '--mnt-max-fra' bounds the SNR points with a low FER
+		const auto t_start = std::chrono::steady_clock::now();
+		run_point(chain, [&monitor]() { return monitor.is_done() || sweep_interrupt; });
+		const auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count();
+
+		// an interrupted point is not complete
+		if (sweep_interrupt)
+		{
+			monitor.reset();
+			break;
+		}
+
+		points.push_back({job, ebn0, esn0, p.chain.codec->enc->K, monitor.get_n_analyzed_fra(), monitor.get_n_be(),
+		                  monitor.get_n_fe(), time});
+		if (store)
+			store->store(key, ebn0, { points.back().n_fra, points.back().n_be, points.back().n_fe, time });
+
+		monitor.reset();
+	}
+}
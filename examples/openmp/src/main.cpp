@@ -2,6 +2,7 @@
 #include <exception>
 #include <iostream>
 #include <cstdlib>
+#include <cstdint>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -10,6 +11,19 @@
 #include <aff3ct.hpp>
 using namespace aff3ct;
 
+#include "Factory/Metrics/Metrics.hpp"
+#include "Factory/Result_store/Result_store.hpp"
+#include "Factory/Terminal/Terminal_extended.hpp"
+#include "Factory/Workers/Workers.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_ring.hpp"
+#include "Tools/Chain/Chain.hpp"
+#include "Tools/Metrics/Metrics_exporter.hpp"
+#include "Tools/Stats/Stats_reduction.hpp"
+#include "Tools/Store/Result_store.hpp"
+#include "Tools/Terminal/Monitor_snapshot.hpp"
+#include "Tools/Terminal/Reporter_snapshot.hpp"
+#include "Tools/Workers/Workers_controller.hpp"
+
 #ifdef _OPENMP
 #include <omp.h>
 #else
@@ -23,13 +37,13 @@ struct params
 	float ebn0_max  = 10.01f; // maximum SNR value
 	float ebn0_step =  1.00f; // SNR step
 	float R;                  // code rate (R=K/N)
+	uint64_t key;             // identify the simulated system in the result store
 
-	std::unique_ptr<factory::Source          ::parameters> source;
-	std::unique_ptr<factory::Codec_repetition::parameters> codec;
-	std::unique_ptr<factory::Modem           ::parameters> modem;
-	std::unique_ptr<factory::Channel         ::parameters> channel;
-	std::unique_ptr<factory::Monitor_BFER    ::parameters> monitor;
-	std::unique_ptr<factory::Terminal        ::parameters> terminal;
+	tools::Chain::parameters                                chain; // the modules of the chain (one chain per thread)
+	std::unique_ptr<factory::Terminal_extended::parameters> terminal;
+	std::unique_ptr<factory::Result_store     ::parameters> store;
+	std::unique_ptr<factory::Metrics          ::parameters> metrics;
+	std::unique_ptr<factory::Workers          ::parameters> workers;
 };
 void init_params(int argc, char** argv, params &p);
 
@@ -39,28 +53,23 @@ using Monitor_BFER_reduction = Monitor_reduction_M<Monitor_BFER<>>;
 
 struct utils
 {
-	std::unique_ptr<tools::Sigma<>>                      noise;         // a sigma noise type
-	std::vector<std::unique_ptr<tools::Reporter>>        reporters;     // list of reporters displayed in the terminal
-	std::unique_ptr<tools::Terminal>                     terminal;      // manage the output text in the terminal
-	std::vector<std::unique_ptr<module::Monitor_BFER<>>> monitors;      // list of the monitors from all the threads
-	std::unique_ptr<module::Monitor_BFER_reduction>      monitor_red;   // main monitor object that reduce all the thread monitors
-	std::vector<std::vector<const module::Module*>>      modules;       // lists of the allocated modules
-	std::vector<std::vector<const module::Module*>>      modules_stats; // list of the allocated modules reorganized for the statistics
+	std::unique_ptr<tools::Sigma<>>                       noise;       // a sigma noise type
+	std::vector<std::unique_ptr<tools::Reporter>>         reporters;   // list of reporters displayed in the terminal
+	std::unique_ptr<tools::Terminal>                      terminal;    // manage the output text in the terminal
+	std::vector<std::unique_ptr<module::Monitor_BFER<>>>  monitors;    // list of the monitors from all the threads
+	std::unique_ptr<module::Monitor_BFER_reduction>       monitor_red; // main monitor object that reduce all the thread monitors
+	std::vector<std::unique_ptr<tools::Monitor_snapshot>> snapshots;   // counters of the monitors for the reporters (or empty)
+	std::vector<std::vector<const module::Module*>>       modules;     // lists of the allocated modules
+	std::unique_ptr<tools::Stats_reduction>               stats;       // statistics of the tasks aggregated over the threads
+	std::unique_ptr<tools::Workers_controller>            workers;     // choose the number of active threads at runtime
+	std::unique_ptr<tools::Result_store>                  store;       // results of the previous simulations (can be null)
+	std::chrono::steady_clock::time_point                 t_start;     // beginning of the current SNR point
+	std::unique_ptr<tools::Metrics_exporter>              metrics;     // serve the live metrics (can be null)
+	uint64_t                                              n_stalls = 0; // frames that waited for their noise
 };
 void init_utils(const params &p, utils &u);
 
-struct modules
-{
-	std::unique_ptr<module::Source<>>       source;
-	std::unique_ptr<module::Codec_SIHO<>>   codec;
-	std::unique_ptr<module::Modem<>>        modem;
-	std::unique_ptr<module::Channel<>>      channel;
-	                module::Monitor_BFER<>* monitor;
-	                module::Encoder<>*      encoder;
-	                module::Decoder_SIHO<>* decoder;
-	std::vector<const module::Module*>      list; // list of module pointers declared in this structure
-};
-void init_modules_and_utils(const params &p, modules &m, utils &u);
+tools::Chain* init_chain_and_utils(const params &p, utils &u);
 
 int main(int argc, char** argv)
 {
@@ -86,8 +95,12 @@ int main(int argc, char** argv)
 	const size_t n_threads = (size_t)omp_get_num_threads();
 	u.monitors.resize(n_threads);
 	u.modules .resize(n_threads);
+	if (p.terminal->use_snapshots() || p.metrics->is_enabled())
+		u.snapshots.resize(n_threads);
 }
-	modules m; init_modules_and_utils(p, m, u); // create and initialize the modules and initialize a part of the utils
+	// create and initialize the chain of the thread (allocated by the thread, on its NUMA node) and a part of the utils
+	std::unique_ptr<tools::Chain> chain(init_chain_and_utils(p, u));
+	const size_t tid = (size_t)omp_get_thread_num();
 
 #pragma omp barrier
 #pragma omp single
@@ -97,15 +110,24 @@ int main(int argc, char** argv)
 	// display the legend in the terminal
 	u.terminal->legend();
 }
-	// sockets binding (connect the sockets of the tasks = fill the input sockets with the output sockets)
-	using namespace module;
-	(*m.encoder)[enc::sck::encode      ::U_K ].bind((*m.source )[src::sck::generate   ::U_K ]);
-	(*m.modem  )[mdm::sck::modulate    ::X_N1].bind((*m.encoder)[enc::sck::encode     ::X_N ]);
-	(*m.channel)[chn::sck::add_noise   ::X_N ].bind((*m.modem  )[mdm::sck::modulate   ::X_N2]);
-	(*m.modem  )[mdm::sck::demodulate  ::Y_N1].bind((*m.channel)[chn::sck::add_noise  ::Y_N ]);
-	(*m.decoder)[dec::sck::decode_siho ::Y_N ].bind((*m.modem  )[mdm::sck::demodulate ::Y_N2]);
-	(*m.monitor)[mnt::sck::check_errors::U   ].bind((*m.encoder)[enc::sck::encode     ::U_K ]);
-	(*m.monitor)[mnt::sck::check_errors::V   ].bind((*m.decoder)[dec::sck::decode_siho::V_K ]);
+	// the threads collect the statistics of their tasks for the metrics every 'period' frames
+	if (u.metrics)
+	{
+		auto stats  = u.stats.get();
+		auto list   = u.modules[tid];
+		auto period = (uint64_t)p.metrics->period;
+		auto frames = (uint64_t)chain->get_monitor().get_n_frames(); // frames checked per call (SIMD width with '-F')
+		uint64_t n  = 0;
+		chain->get_monitor().add_handler_check([stats, tid, list, period, frames, n]() mutable
+		{
+			n += frames;
+			if (n >= period)
+			{
+				n %= period;
+				stats->collect(tid, list);
+			}
+		});
+	}
 
 	// loop over the various SNRs
 	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
@@ -114,30 +136,63 @@ int main(int argc, char** argv)
 		const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
 		const auto sigma = tools::esn0_to_sigma(esn0     );
 
+		// skip the SNR points that were already simulated with the same parameters (all the threads take the same
+		// decision: the store is only modified between two barriers)
+		tools::Result_store::Point stored;
+		if (u.store && p.store->lookup && u.store->find(p.key, ebn0, stored))
+		{
+#pragma omp single
+			tools::Result_store::display(std::cout, ebn0, p.chain.codec->enc->K, stored);
+			continue;
+		}
+
 #pragma omp single
+{
 		u.noise->set_noise(sigma, ebn0, esn0);
+		if (u.metrics) u.metrics->set_ebn0(ebn0);
+}
 
-		// update the sigma of the modem and the channel
-		m.codec  ->set_noise(*u.noise);
-		m.modem  ->set_noise(*u.noise);
-		m.channel->set_noise(*u.noise);
+		// update the sigma of the modules of the chain
+		chain->set_noise(*u.noise);
 
 #pragma omp single
+{
 		// display the performance (BER and FER) in real time (in a separate thread)
+		for (auto &s : u.snapshots)
+			s->reset();
 		u.terminal->start_temp_report();
 
+		// measure the throughput with an increasing number of active threads during the first part of the SNR point
+		u.workers->start();
+		u.t_start = std::chrono::steady_clock::now();
+}
+
+		// the stages out of the simulation loop (the all-zero codeword is generated, encoded and modulated only once)
+		chain->exec_once();
+
 		// run the simulation chain
 		while (!u.monitor_red->is_done_all() && !u.terminal->is_interrupt())
 		{
-			(*m.source )[src::tsk::generate    ].exec();
-			(*m.encoder)[enc::tsk::encode      ].exec();
-			(*m.modem  )[mdm::tsk::modulate    ].exec();
-			(*m.channel)[chn::tsk::add_noise   ].exec();
-			(*m.modem  )[mdm::tsk::demodulate  ].exec();
-			(*m.decoder)[dec::tsk::decode_siho ].exec();
-			(*m.monitor)[mnt::tsk::check_errors].exec();
+			// this thread does not raise the throughput: wait without using the core
+			if (!u.workers->is_active(tid))
+			{
+				u.workers->park(tid);
+				continue;
+			}
+
+			chain->exec_loop();
+
+			u.workers->count_frame(tid);
+			if (tid == 0)
+				u.workers->update();
 		}
 
+		// wake up the parked threads, they have to leave the loop too
+		u.workers->release();
+
+		// add the statistics of the tasks of this thread to the aggregated statistics
+		u.stats->collect(tid, u.modules[tid]);
+
 // need to wait all the threads here before to reset the 'monitors' and 'terminal' states
 #pragma omp barrier
 #pragma omp single
@@ -147,6 +202,16 @@ int main(int argc, char** argv)
 
 		// display the performance (BER and FER) in the terminal
 		u.terminal->final_report();
+		if (p.workers->adaptive)
+			std::cout << "# Active threads: " << u.workers->get_n_active() << "/" << u.workers->get_n_threads()
+			          << std::endl;
+
+		// append the SNR point to the result store (an interrupted point is not complete)
+		if (u.store && !u.terminal->is_interrupt())
+			u.store->store(p.key, ebn0, { u.monitor_red->get_n_analyzed_fra(), u.monitor_red->get_n_be(),
+			                              u.monitor_red->get_n_fe(),
+			                              std::chrono::duration<double>(std::chrono::steady_clock::now() -
+			                                                            u.t_start).count() });
 
 		// reset the monitor and the terminal for the next SNR
 		u.monitor_red->reset_all();
@@ -156,11 +221,24 @@ int main(int argc, char** argv)
 		if (u.terminal->is_over()) break;
 	}
 
+	// sum the frames that waited for their noise over the threads
+	auto ring = dynamic_cast<const module::Channel_AWGN_LLR_ring<>*>(&chain->get_channel());
+	if (ring)
+	{
+		const auto n_stalls = ring->get_n_stalls();
+#pragma omp atomic
+		u.n_stalls += n_stalls;
+	}
+
+#pragma omp barrier
 #pragma omp single
 {
 	// display the statistics of the tasks (if enabled)
 	std::cout << "#" << std::endl;
-	tools::Stats::show(u.modules_stats, true);
+	u.stats->show(std::cout, true);
+	// add producers with '--chn-ring-producers' when it is not small
+	if (ring)
+		std::cout << "# Noise ring stalls: " << u.n_stalls << std::endl;
 	std::cout << "# End of the simulation" << std::endl;
 }
 }
@@ -169,18 +247,33 @@ int main(int argc, char** argv)
 
 void init_params(int argc, char** argv, params &p)
 {
-	p.source   = std::unique_ptr<factory::Source          ::parameters>(new factory::Source          ::parameters());
-	p.codec    = std::unique_ptr<factory::Codec_repetition::parameters>(new factory::Codec_repetition::parameters());
-	p.modem    = std::unique_ptr<factory::Modem           ::parameters>(new factory::Modem           ::parameters());
-	p.channel  = std::unique_ptr<factory::Channel         ::parameters>(new factory::Channel         ::parameters());
-	p.monitor  = std::unique_ptr<factory::Monitor_BFER    ::parameters>(new factory::Monitor_BFER    ::parameters());
-	p.terminal = std::unique_ptr<factory::Terminal        ::parameters>(new factory::Terminal        ::parameters());
-
-	std::vector<factory::Factory::parameters*> params_list = { p.source .get(), p.codec  .get(), p.modem   .get(),
-	                                                           p.channel.get(), p.monitor.get(), p.terminal.get() };
+	auto &c = p.chain;
+	c.source   = std::unique_ptr<factory::Source           ::parameters>(new factory::Source           ::parameters());
+	c.family   = std::unique_ptr<factory::Codec_generic    ::parameters>(new factory::Codec_generic    ::parameters());
+	c.family->pre_parse(argc, argv); // the parameters of the codec depend on its family
+	c.codec    = std::unique_ptr<factory::Codec_SIHO       ::parameters>(c.family->make_codec());
+	c.modem    = std::unique_ptr<factory::Modem_extended   ::parameters>(new factory::Modem_extended   ::parameters());
+	c.channel  = std::unique_ptr<factory::Channel_extended ::parameters>(new factory::Channel_extended ::parameters());
+	c.monitor  = std::unique_ptr<factory::Monitor_BFER     ::parameters>(new factory::Monitor_BFER     ::parameters());
+	p.terminal = std::unique_ptr<factory::Terminal_extended::parameters>(new factory::Terminal_extended::parameters());
+	p.store    = std::unique_ptr<factory::Result_store     ::parameters>(new factory::Result_store     ::parameters());
+	p.metrics  = std::unique_ptr<factory::Metrics          ::parameters>(new factory::Metrics          ::parameters());
+	p.workers  = std::unique_ptr<factory::Workers          ::parameters>(new factory::Workers          ::parameters());
+
+	std::vector<factory::Factory::parameters*> params_list = { c.source  .get(), c.family .get(), c.codec  .get(),
+	                                                           c.modem   .get(), c.channel.get(), c.monitor.get(),
+	                                                           p.terminal.get(), p.store  .get(), p.metrics.get(),
+	                                                           p.workers .get()                                   };
+
+	// the inter-frame SIMD mode sets the number of frames of the modules and the SIMD strategy of the decoder
+	std::vector<std::string> args(argv, argv + argc);
+	c.family->complete_args(args, *c.codec, params_list);
+	std::vector<char*> args_ptr;
+	for (auto &a : args)
+		args_ptr.push_back(const_cast<char*>(a.c_str()));
 
 	// parse the command for the given parameters and fill them
-	factory::Command_parser cp(argc, argv, params_list, true);
+	factory::Command_parser cp((int)args_ptr.size(), args_ptr.data(), params_list, true);
 	if (cp.parsing_failed())
 	{
 		cp.print_help    ();
@@ -189,60 +282,45 @@ void init_params(int argc, char** argv, params &p)
 		std::exit(1);
 	}
 
+	// the channel transmits the modulated frames (real and imaginary parts of the symbols for the complex modulations)
+	c.channel->N       = c.modem->N_mod;
+	c.channel->complex = c.modem->complex;
+
 	std::cout << "# Simulation parameters: " << std::endl;
 	factory::Header::print_parameters(params_list); // display the headers (= print the AFF3CT parameters on the screen)
 	std::cout << "#" << std::endl;
 	cp.print_warnings();
 
-	p.R = (float)p.codec->enc->K / (float)p.codec->enc->N_cw; // compute the code rate
+	p.R = (float)c.codec->enc->K / (float)c.codec->enc->N_cw; // compute the code rate
+
+	// hash of the parameters that change the results
+	p.key = tools::Result_store::make_key({ c.source.get(), c.codec.get(), c.modem.get(), c.channel.get(),
+	                                        c.monitor.get() });
 }
 
-void init_modules_and_utils(const params &p, modules &m, utils &u)
+tools::Chain* init_chain_and_utils(const params &p, utils &u)
 {
 	// get the thread id from OpenMP
 	const int tid = omp_get_thread_num();
 
-	// set different seeds for different threads when the module use a PRNG
-	p.source->seed += tid;
-	p.channel->seed += tid;
-
-	m.source        = std::unique_ptr<module::Source      <>>(p.source ->build());
-	m.codec         = std::unique_ptr<module::Codec_SIHO  <>>(p.codec  ->build());
-	m.modem         = std::unique_ptr<module::Modem       <>>(p.modem  ->build());
-	m.channel       = std::unique_ptr<module::Channel     <>>(p.channel->build());
-	u.monitors[tid] = std::unique_ptr<module::Monitor_BFER<>>(p.monitor->build());
-	m.monitor       = u.monitors[tid].get();
-	m.encoder       = m.codec->get_encoder().get();
-	m.decoder       = m.codec->get_decoder_siho().get();
-
-	m.list = { m.source.get(), m.modem.get(), m.channel.get(), m.monitor, m.encoder, m.decoder };
-	u.modules[tid] = m.list;
-
-	// configuration of the module tasks
-	for (auto& mod : m.list)
-		for (auto& tsk : mod->tasks)
-		{
-			tsk->set_autoalloc  (true ); // enable the automatic allocation of the data in the tasks
-			tsk->set_autoexec   (false); // disable the auto execution mode of the tasks
-			tsk->set_debug      (false); // disable the debug mode
-			tsk->set_debug_limit(16   ); // display only the 16 first bits if the debug mode is enabled
-			tsk->set_stats      (true ); // enable the statistics
-
-			// enable the fast mode (= disable the useless verifs in the tasks) if there is no debug and stats modes
-			if (!tsk->is_debug() && !tsk->is_stats())
-				tsk->set_fast(true);
-		}
-
-	// reset the memory of the decoder after the end of each communication
-	m.monitor->add_handler_check(std::bind(&module::Decoder::reset, m.decoder));
+	// different seeds for different threads when the modules use a PRNG
+	auto chain = new tools::Chain(p.chain, u.monitors[tid], tid);
+	std::vector<const module::Module*> list(chain->get_modules().begin(), chain->get_modules().end());
+	u.modules[tid] = list;
 
-	// initialize the interleaver if this code use an interleaver
-	try
+	if (!u.snapshots.empty())
 	{
-		auto& interleaver = m.codec->get_interleaver();
-		interleaver->init();
+		// the monitor of the thread publishes its counters after each check (allocated by the thread, on its node)
+		u.snapshots[tid] = std::unique_ptr<tools::Monitor_snapshot>(new tools::Monitor_snapshot());
+		auto monitor  = &chain->get_monitor();
+		auto snapshot = u.snapshots[tid].get();
+		monitor->add_handler_check([monitor, snapshot]()
+		{
+			snapshot->publish(monitor->get_n_analyzed_fra(), monitor->get_n_be(), monitor->get_n_fe());
+		});
 	}
-	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+
+	return chain;
 }
 
 void init_utils(const params &p, utils &u)
@@ -254,15 +332,33 @@ void init_utils(const params &p, utils &u)
 	u.noise = std::unique_ptr<tools::Sigma<>>(new tools::Sigma<>());
 	// report the noise values (Es/N0 and Eb/N0)
 	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_noise<>(*u.noise)));
-	// report the bit/frame error rates
-	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_BFER<>(*u.monitor_red)));
-	// report the simulation throughputs
-	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(*u.monitor_red)));
+	std::vector<const tools::Monitor_snapshot*> snapshots;
+	for (auto &s : u.snapshots)
+		snapshots.push_back(s.get());
+	if (p.terminal->use_snapshots())
+	{
+		// report the bit/frame error rates and the simulation throughputs (sum of the snapshots of the threads)
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_snapshot(snapshots,
+		                                                                                    p.chain.codec->enc->K)));
+	}
+	else
+	{
+		// report the bit/frame error rates
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_BFER<>(*u.monitor_red)));
+		// report the simulation throughputs
+		u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(*u.monitor_red)));
+	}
 	// create a terminal that will display the collected data from the reporters
-	u.terminal = std::unique_ptr<tools::Terminal>(p.terminal->build(u.reporters));
-
-	u.modules_stats.resize(u.modules[0].size());
-	for (size_t m = 0; m < u.modules[0].size(); m++)
-		for (size_t t = 0; t < u.modules.size(); t++)
-			u.modules_stats[m].push_back(u.modules[t][m]);
+	u.terminal = std::unique_ptr<tools::Terminal>(p.terminal->build(u.reporters, u.noise.get()));
+	// aggregate the statistics of the tasks over the threads (one row per task)
+	u.stats = std::unique_ptr<tools::Stats_reduction>(new tools::Stats_reduction(u.modules[0], u.modules.size()));
+	// park the threads that do not raise the throughput (e.g. when the chain is memory bound)
+	u.workers = std::unique_ptr<tools::Workers_controller>(p.workers->build(u.modules.size()));
+	// open the store of the simulated SNR points
+	if (p.store->is_enabled())
+		u.store = std::unique_ptr<tools::Result_store>(p.store->build());
+	// serve the live metrics (the snapshots of the monitors and the statistics of the tasks of all the threads)
+	if (p.metrics->is_enabled())
+		u.metrics = std::unique_ptr<tools::Metrics_exporter>(p.metrics->build(snapshots, p.chain.codec->enc->K,
+		                                                                     u.stats.get()));
 }
\ No newline at end of file
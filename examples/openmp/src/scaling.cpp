@@ -0,0 +1,399 @@
+#include <algorithm>
+#include <numeric>
+#include <exception>
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <aff3ct.hpp>
+using namespace aff3ct;
+
+#include "Factory/Scaling/Scaling.hpp"
+#include "Factory/Workers/Workers.hpp"
+#include "Tools/Chain/Chain.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+inline int omp_get_thread_num () { return 0; }
+#endif
+
+struct params
+{
+	float R; // code rate (R=K/N)
+
+	tools::Chain::parameters                      chain;   // the modules of the chain (the same as in 'my_project')
+	std::unique_ptr<factory::Scaling::parameters> scaling;
+	std::unique_ptr<factory::Workers::parameters> workers; // the adaptive number of threads of 'my_project'
+
+};
+void init_params(int argc, char** argv, params &p);
+
+namespace aff3ct { namespace module {
+using Monitor_BFER_reduction = Monitor_reduction_M<Monitor_BFER<>>;
+} }
+
+// the chains of all the threads, built once: a run on 'n' threads uses the 'n' first chains
+struct bench
+{
+	std::unique_ptr<tools::Sigma<>>                      noise;
+	std::vector<std::unique_ptr<module::Monitor_BFER<>>> monitors;    // the monitors of the threads
+	std::unique_ptr<module::Monitor_BFER_reduction>      monitor_red; // reduction of the monitors (reset between runs)
+	std::vector<std::unique_ptr<tools::Chain>>           chains;      // one chain per thread
+	std::unique_ptr<tools::Workers_controller>           workers;     // choose the number of active threads (adaptive)
+	double                                               mem_thread;  // size of the buffers of the sockets of a chain
+};
+void init_bench(const params &p, const size_t n_threads, bench &b);
+
+// one run of the chain on 'n_threads' threads
+struct run
+{
+	std::string mode;          // "strong", "weak" or "adapt"
+	size_t      n_threads;     // number of active threads (chosen by the workers controller in the "adapt" mode)
+	uint64_t    n_frames;      // total number of simulated frames
+	double      time;          // wall time of the simulation (s)
+	double      t_reduction;   // mean time per thread in the reductions of the monitors (s)
+	double      t_barrier;     // mean time per thread waiting for the other threads at the end (s)
+	double      imbalance;     // longest busy time of a thread over the mean busy time of the threads, minus 1
+	double      mem_thread;    // size of the buffers of the sockets of a thread (bytes)
+	double      throughput;    // information throughput (Mb/s)
+	double      speedup;
+	double      efficiency;
+};
+// 'n_calls[t]' is the number of executions of the chain by the thread 't', there is one thread per element; with the
+// workers controller, the calls are shared by the active threads
+run simulate(const params &p, bench &b, const std::string &mode, const std::vector<uint64_t> &n_calls,
+             tools::Workers_controller *workers = nullptr);
+
+void display(const std::vector<run> &runs, std::ostream &stream);
+
+int main(int argc, char** argv)
+{
+	// get the AFF3CT version
+	const std::string v = "v" + std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "# This is a basic program using the AFF3CT library (" << v << ")" << std::endl;
+	std::cout << "# Feel free to improve it as you want to fit your needs."         << std::endl;
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "#"                                                                << std::endl;
+
+	params p; init_params(argc, argv, p); // create and initialize the parameters from the command line with factories
+
+	// numbers of threads: the powers of 2 and the number of hardware threads
+	const size_t hw_threads = std::max(1u, std::thread::hardware_concurrency());
+#ifdef _OPENMP
+	const size_t max_threads = p.scaling->max_threads ? (size_t)p.scaling->max_threads : hw_threads;
+#else
+	const size_t max_threads = 1; // the 'omp parallel' regions are sequential
+	(void)hw_threads;
+#endif
+	std::vector<size_t> threads;
+	for (size_t t = 1; t < max_threads; t *= 2)
+		threads.push_back(t);
+	threads.push_back(max_threads);
+
+	std::vector<run> runs;
+	try
+	{
+		bench b; init_bench(p, max_threads, b);
+		const auto n_frames_call = (uint64_t)b.chains[0]->get_monitor().get_n_frames(); // frames per call of a chain
+
+		// the runs process different numbers of frames (the frames are simulated by calls of the chains): the speedup
+		// is the ratio of the throughputs (the weak speedup is the scaled speedup)
+		auto scale = [&runs](const size_t first)
+		{
+			runs.back().speedup    = runs.back().throughput / runs[first].throughput;
+			runs.back().efficiency = runs.back().speedup / (double)runs.back().n_threads;
+			display({ runs.back() }, std::cout);
+		};
+
+		// the total number of calls is shared by the threads (the first threads make one more call)
+		const auto total = (p.scaling->frames + n_frames_call -1) / n_frames_call;
+		auto share = [total](const size_t n)
+		{
+			std::vector<uint64_t> n_calls(n, total / n);
+			for (size_t t = 0; t < total % n; t++)
+				n_calls[t]++;
+			return n_calls;
+		};
+
+		const size_t first_strong = runs.size(); // reference run on 1 thread
+		if (p.scaling->is_strong())
+		{
+			for (auto n : threads)
+			{
+				runs.push_back(simulate(p, b, "strong", share(n)));
+				scale(first_strong);
+			}
+
+			// the same frames with the number of active threads chosen at runtime (like 'my_project --wrk-adaptive')
+			if (p.workers->adaptive)
+			{
+				runs.push_back(simulate(p, b, "adapt", share(max_threads), b.workers.get()));
+				scale(first_strong);
+			}
+		}
+
+		const size_t first_weak = runs.size(); // reference run on 1 thread
+		if (p.scaling->is_weak())
+			for (auto n : threads)
+			{
+				// each thread simulates the same number of frames
+				const auto calls = (p.scaling->frames_thread + n_frames_call -1) / n_frames_call;
+				runs.push_back(simulate(p, b, "weak", std::vector<uint64_t>(n, calls)));
+				scale(first_weak);
+			}
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+#ifndef _WIN32
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		std::cout << "# Peak resident memory of the process: " << usage.ru_maxrss / 1024 << " MB" << std::endl;
+#endif
+
+	if (!p.scaling->csv_path.empty())
+	{
+		std::ofstream csv(p.scaling->csv_path);
+		if (!csv.is_open())
+		{
+			std::cerr << "# The CSV file cannot be opened ('p.scaling->csv_path' = " << p.scaling->csv_path << ")."
+			          << std::endl;
+			return EXIT_FAILURE;
+		}
+		csv << "mode,n_threads,n_frames,time_s,throughput_mbps,speedup,efficiency,reduction_s,barrier_s,imbalance,"
+		    << "mem_thread_bytes" << std::endl;
+		for (auto &r : runs)
+			csv << r.mode << "," << r.n_threads << "," << r.n_frames << "," << r.time << "," << r.throughput << ","
+			    << r.speedup << "," << r.efficiency << "," << r.t_reduction << "," << r.t_barrier << ","
+			    << r.imbalance << "," << r.mem_thread << std::endl;
+	}
+
+	std::cout << "# End of the scaling benchmark" << std::endl;
+
+	return EXIT_SUCCESS;
+}
+
+void init_params(int argc, char** argv, params &p)
+{
+	auto &c = p.chain;
+	c.source  = std::unique_ptr<factory::Source          ::parameters>(new factory::Source          ::parameters());
+	c.family  = std::unique_ptr<factory::Codec_generic   ::parameters>(new factory::Codec_generic   ::parameters());
+	c.family->pre_parse(argc, argv); // the parameters of the codec depend on its family
+	c.codec   = std::unique_ptr<factory::Codec_SIHO      ::parameters>(c.family->make_codec());
+	c.modem   = std::unique_ptr<factory::Modem_extended  ::parameters>(new factory::Modem_extended  ::parameters());
+	c.channel = std::unique_ptr<factory::Channel_extended::parameters>(new factory::Channel_extended::parameters());
+	c.monitor = std::unique_ptr<factory::Monitor_BFER    ::parameters>(new factory::Monitor_BFER    ::parameters());
+	p.scaling = std::unique_ptr<factory::Scaling         ::parameters>(new factory::Scaling         ::parameters());
+	p.workers = std::unique_ptr<factory::Workers         ::parameters>(new factory::Workers         ::parameters());
+
+	std::vector<factory::Factory::parameters*> params_list = { c.source.get(), c.family .get(), c.codec  .get(),
+	                                                           c.modem .get(), c.channel.get(), c.monitor.get(),
+	                                                           p.scaling.get(), p.workers.get()                 };
+
+	// the inter-frame SIMD mode sets the number of frames of the modules and the SIMD strategy of the decoder
+	std::vector<std::string> args(argv, argv + argc);
+	c.family->complete_args(args, *c.codec, params_list);
+	std::vector<char*> args_ptr;
+	for (auto &a : args)
+		args_ptr.push_back(const_cast<char*>(a.c_str()));
+
+	// parse the command for the given parameters and fill them
+	factory::Command_parser cp((int)args_ptr.size(), args_ptr.data(), params_list, true);
+	if (cp.parsing_failed())
+	{
+		cp.print_help    ();
+		cp.print_warnings();
+		cp.print_errors  ();
+		std::exit(1);
+	}
+
+	// the channel transmits the modulated frames (real and imaginary parts of the symbols for the complex modulations)
+	c.channel->N       = c.modem->N_mod;
+	c.channel->complex = c.modem->complex;
+
+	std::cout << "# Simulation parameters: " << std::endl;
+	factory::Header::print_parameters(params_list); // display the headers (= print the AFF3CT parameters on the screen)
+	std::cout << "#" << std::endl;
+	cp.print_warnings();
+
+	p.R = (float)c.codec->enc->K / (float)c.codec->enc->N_cw; // compute the code rate
+}
+
+void init_bench(const params &p, const size_t n_threads, bench &b)
+{
+	// compute the sigma of the channel noise
+	const auto ebn0  = p.scaling->ebn0;
+	const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
+	const auto sigma = tools::esn0_to_sigma(esn0     );
+	b.noise = std::unique_ptr<tools::Sigma<>>(new tools::Sigma<>());
+	b.noise->set_noise(sigma, ebn0, esn0);
+
+	b.monitors.resize(n_threads);
+	b.chains  .resize(n_threads);
+
+#pragma omp parallel num_threads((int)n_threads)
+{
+	// each thread allocates its chain (on its NUMA node), the tasks are in fast mode (no statistics)
+	const size_t tid = (size_t)omp_get_thread_num();
+	b.chains[tid] = std::unique_ptr<tools::Chain>(new tools::Chain(p.chain, b.monitors[tid], (int)tid, false));
+	b.chains[tid]->set_noise(*b.noise);
+}
+
+	// memory of the chain of a thread: the buffers of the sockets
+	b.mem_thread = 0.;
+	for (auto mod : b.chains[0]->get_modules())
+		for (auto &tsk : mod->tasks)
+			for (auto &s : tsk->sockets)
+				b.mem_thread += (double)s->get_databytes();
+
+	// the same reduction as the 'openmp' example (the monitors are reduced every 500 ms), the monitors of the threads
+	// that are not used by a run stay at zero
+	b.monitor_red = std::unique_ptr<module::Monitor_BFER_reduction>(new module::Monitor_BFER_reduction(b.monitors));
+	b.monitor_red->set_reduce_frequency(std::chrono::milliseconds(500));
+
+	b.workers = std::unique_ptr<tools::Workers_controller>(p.workers->build(n_threads));
+}
+
+run simulate(const params &p, bench &b, const std::string &mode, const std::vector<uint64_t> &n_calls,
+             tools::Workers_controller *workers)
+{
+	using clock = std::chrono::steady_clock;
+	auto seconds = [](const clock::duration d) { return std::chrono::duration<double>(d).count(); };
+
+	const size_t n_threads = n_calls.size();
+	std::vector<double> t_reduction(n_threads, 0.), t_barrier(n_threads, 0.), t_busy(n_threads, 0.);
+	clock::time_point t_start, t_stop;
+	const auto total = std::accumulate(n_calls.begin(), n_calls.end(), (uint64_t)0);
+	std::atomic<uint64_t> next(0); // next call shared by the active threads (with the workers controller)
+
+	b.monitor_red->reset_all();
+
+#pragma omp parallel num_threads((int)n_threads)
+{
+	const size_t tid = (size_t)omp_get_thread_num();
+	auto &chain = *b.chains[tid];
+
+#pragma omp single
+{
+	if (workers) workers->start();
+	t_start = clock::now();
+}
+
+	auto t_red = clock::duration::zero();
+	const auto t_loop_start = clock::now();
+	for (uint64_t c = 0; ; c++)
+	{
+		if (workers)
+		{
+			// the same parking as the loop of the 'openmp' example, the parked threads leave when all the calls are
+			// taken
+			if (!workers->is_active(tid))
+			{
+				workers->park(tid);
+				if (next.load() >= total) break;
+				continue;
+			}
+			if (next.fetch_add(1) >= total) break;
+		}
+		else if (c == n_calls[tid])
+			break;
+
+		chain.exec();
+
+		// the same check as the loop of the 'openmp' example
+		const auto t_red_start = clock::now();
+		b.monitor_red->is_done_all();
+		t_red += clock::now() - t_red_start;
+
+		if (workers)
+		{
+			workers->count_frame(tid);
+			if (tid == 0)
+				workers->update();
+		}
+	}
+	// wake up the parked threads, they have to leave the loop too
+	if (workers) workers->release();
+	const auto t_loop_stop = clock::now();
+	t_busy[tid] = seconds(t_loop_stop - t_loop_start);
+
+#pragma omp barrier
+	t_barrier[tid] = seconds(clock::now() - t_loop_stop);
+
+#pragma omp single
+{
+	// final reduction
+	const auto t_red_start = clock::now();
+	b.monitor_red->is_done_all(true, true);
+	t_red += clock::now() - t_red_start;
+	t_stop = clock::now();
+}
+	t_reduction[tid] = seconds(t_red);
+}
+
+	const auto busy_mean = std::accumulate(t_busy.begin(), t_busy.end(), 0.) / (double)n_threads;
+	const auto busy_max  = *std::max_element(t_busy.begin(), t_busy.end());
+
+	run r;
+	r.mode        = mode;
+	r.n_threads   = workers ? workers->get_n_active() : n_threads;
+	r.n_frames    = b.monitor_red->get_n_analyzed_fra();
+	r.time        = seconds(t_stop - t_start);
+	r.t_reduction = std::accumulate(t_reduction.begin(), t_reduction.end(), 0.) / (double)n_threads;
+	r.t_barrier   = std::accumulate(t_barrier  .begin(), t_barrier  .end(), 0.) / (double)n_threads;
+	r.imbalance   = busy_mean > 0. ? busy_max / busy_mean - 1. : 0.;
+	r.mem_thread  = b.mem_thread;
+	r.throughput  = (double)r.n_frames * (double)p.chain.codec->enc->K / r.time * 1e-6;
+	r.speedup     = 1.;
+	r.efficiency  = 1.;
+	return r;
+}
+
+void display(const std::vector<run> &runs, std::ostream &stream)
+{
+	static bool legend = true;
+	const std::string sep = "# -------|---------|------------|----------|------------|---------|-------|"
+	                        "-----------|-----------|--------|-----------";
+	if (legend)
+	{
+		stream << sep << std::endl;
+		stream << "#   MODE | THREADS |     FRAMES |     TIME | THROUGHPUT | SPEEDUP | EFFI. |"
+		          " REDUCTION |   BARRIER | IMBAL. |   MEM/THR " << std::endl;
+		stream << "#        |         |            |      (s) |     (Mb/s) |         |   (%) |"
+		          "   (%time) |   (%time) |    (%) |      (KB) " << std::endl;
+		stream << sep << std::endl;
+		legend = false;
+	}
+
+	for (auto &r : runs)
+		stream << "# " << std::setw(6) << r.mode << " | " << std::setw(7) << r.n_threads << " | "
+		       << std::setw(10) << r.n_frames << " | "
+		       << std::fixed << std::setprecision(3) << std::setw(8) << r.time << " | "
+		       << std::setprecision(2) << std::setw(10) << r.throughput << " | "
+		       << std::setw(7) << r.speedup << " | "
+		       << std::setprecision(1) << std::setw(5) << 100. * r.efficiency << " | "
+		       << std::setw(9) << 100. * r.t_reduction / r.time << " | "
+		       << std::setw(9) << 100. * r.t_barrier   / r.time << " | "
+		       << std::setw(6) << 100. * r.imbalance << " | "
+		       << std::setw(9) << r.mem_thread / 1024. << std::endl;
+	stream.unsetf(std::ios::floatfield);
+}
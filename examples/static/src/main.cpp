@@ -0,0 +1,304 @@
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <array>
+
+#include <aff3ct.hpp>
+using namespace aff3ct;
+
+#include "Module/Source/Random/Source_random_static.hpp"
+#include "Module/Encoder/Repetition/Encoder_repetition_static.hpp"
+#include "Module/Modem/BPSK/Modem_BPSK_static.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_static.hpp"
+#include "Module/Decoder/Repetition/Decoder_repetition_static.hpp"
+#include "Module/Monitor/BFER/Monitor_BFER_static.hpp"
+
+// the sizes of the static chain are known at compile time
+constexpr int K =  32; // number of information bits
+constexpr int N = 128; // codeword size
+
+struct params
+{
+	int      fe        =      100; // number of frame errors
+	int      seed      =        0; // PRNG seed for the AWGN channel
+	float    ebn0_min  =    0.00f; // minimum SNR value
+	float    ebn0_max  =    6.01f; // maximum SNR value
+	float    ebn0_step =    1.00f; // SNR step
+	float    ebn0_bench=    4.00f; // SNR of the benchmark
+	uint64_t n_runs    = 10000000; // number of frames of the benchmark (per stage)
+	float    R;                    // code rate (R=K/N)
+};
+void init_params(params &p);
+
+// runtime sized modules (same as the 'bootstrap' example)
+struct modules
+{
+	std::unique_ptr<module::Source_random<>>          source;
+	std::unique_ptr<module::Encoder_repetition_sys<>> encoder;
+	std::unique_ptr<module::Modem_BPSK<>>             modem;
+	std::unique_ptr<module::Channel_AWGN_LLR<>>       channel;
+	std::unique_ptr<module::Decoder_repetition_std<>> decoder;
+	std::unique_ptr<module::Monitor_BFER<>>           monitor;
+	std::unique_ptr<tools::Sigma<>>                   noise;
+};
+void init_modules(const params &p, modules &m);
+
+struct buffers
+{
+	std::vector<int  > ref_bits;
+	std::vector<int  > enc_bits;
+	std::vector<float> symbols;
+	std::vector<float> noisy_symbols;
+	std::vector<float> LLRs;
+	std::vector<int  > dec_bits;
+};
+void init_buffers(buffers &b);
+
+// compile-time sized modules
+struct modules_static
+{
+	module::Source_random_static     <K  > source;
+	module::Encoder_repetition_static<K,N> encoder;
+	module::Modem_BPSK_static        <  N> modem;
+	module::Channel_AWGN_LLR_static  <  N> channel;
+	module::Decoder_repetition_static<K,N> decoder;
+	module::Monitor_BFER_static      <K  > monitor;
+
+	modules_static(const params &p) : channel(p.seed), monitor(p.fe) {}
+};
+
+struct buffers_static
+{
+	std::array<int,  K> ref_bits;
+	std::array<int,  N> enc_bits;
+	std::array<float,N> symbols;
+	std::array<float,N> noisy_symbols;
+	std::array<float,N> LLRs;
+	std::array<int,  K> dec_bits;
+};
+
+void set_sigma(const float ebn0, const params &p, modules &m, modules_static &s);
+void benchmark(const params &p, modules &m, buffers &b, modules_static &s, buffers_static &bs);
+
+int main(int argc, char** argv)
+{
+	// get the AFF3CT version
+	const std::string v = "v" + std::to_string(tools::version_major()) + "." +
+	                            std::to_string(tools::version_minor()) + "." +
+	                            std::to_string(tools::version_release());
+
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "# This is a basic program using the AFF3CT library (" << v << ")" << std::endl;
+	std::cout << "# Feel free to improve it as you want to fit your needs."         << std::endl;
+	std::cout << "#----------------------------------------------------------"      << std::endl;
+	std::cout << "#"                                                                << std::endl;
+
+	params p;         init_params (p   ); // create and initialize the parameters defined by the user
+	modules m;        init_modules(p, m); // create and initialize the runtime sized modules
+	buffers b;        init_buffers(b   ); // create and initialize the buffers required by the modules
+	modules_static s(p);                  // the compile-time sized modules
+	buffers_static bs;                    // the compile-time sized buffers
+
+	// the two chains have to give the same error rates (the PRNGs are different, the frames are not the same)
+	std::cout << "# Error rates of the two chains:" << std::endl;
+	std::cout << "# -------|-------------------------|-------------------------" << std::endl;
+	std::cout << "#  Eb/N0 |         runtime sizes   |    compile-time sizes   " << std::endl;
+	std::cout << "#   (dB) |         BER |       FER |         BER |       FER " << std::endl;
+	std::cout << "# -------|-------------|-----------|-------------|-----------" << std::endl;
+	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
+	{
+		set_sigma(ebn0, p, m, s);
+
+		while (!m.monitor->fe_limit_achieved())
+		{
+			m.source ->generate    (                 b.ref_bits     );
+			m.encoder->encode      (b.ref_bits,      b.enc_bits     );
+			m.modem  ->modulate    (b.enc_bits,      b.symbols      );
+			m.channel->add_noise   (b.symbols,       b.noisy_symbols);
+			m.modem  ->demodulate  (b.noisy_symbols, b.LLRs         );
+			m.decoder->decode_siho (b.LLRs,          b.dec_bits     );
+			m.monitor->check_errors(b.dec_bits,      b.ref_bits     );
+		}
+
+		while (!s.monitor.fe_limit_achieved())
+		{
+			s.source .generate    (                  bs.ref_bits     );
+			s.encoder.encode      (bs.ref_bits,      bs.enc_bits     );
+			s.modem  .modulate    (bs.enc_bits,      bs.symbols      );
+			s.channel.add_noise   (bs.symbols,       bs.noisy_symbols);
+			s.modem  .demodulate  (bs.noisy_symbols, bs.LLRs         );
+			s.decoder.decode_siho (bs.LLRs,          bs.dec_bits     );
+			s.monitor.check_errors(bs.ref_bits,      bs.dec_bits     );
+		}
+
+		std::cout << "# " << std::setw(6) << std::fixed << std::setprecision(2) << ebn0 << " | "
+		          << std::scientific << std::setprecision(4)
+		          << std::setw(11) << m.monitor->get_ber() << " | " << std::setw(9) << m.monitor->get_fer() << " | "
+		          << std::setw(11) << s.monitor .get_ber() << " | " << std::setw(9) << s.monitor .get_fer()
+		          << std::endl;
+		std::cout.unsetf(std::ios::floatfield);
+
+		m.monitor->reset();
+		s.monitor .reset();
+	}
+	std::cout << "#" << std::endl;
+
+	benchmark(p, m, b, s, bs);
+
+	std::cout << "# End of the simulation" << std::endl;
+
+	return 0;
+}
+
+void init_params(params &p)
+{
+	p.R = (float)K / (float)N;
+	std::cout << "# * Simulation parameters: "              << std::endl;
+	std::cout << "#    ** Frame errors   = " << p.fe        << std::endl;
+	std::cout << "#    ** Noise seed     = " << p.seed      << std::endl;
+	std::cout << "#    ** Info. bits (K) = " << K           << std::endl;
+	std::cout << "#    ** Frame size (N) = " << N           << std::endl;
+	std::cout << "#    ** Code rate  (R) = " << p.R         << std::endl;
+	std::cout << "#    ** SNR min   (dB) = " << p.ebn0_min  << std::endl;
+	std::cout << "#    ** SNR max   (dB) = " << p.ebn0_max  << std::endl;
+	std::cout << "#    ** SNR step  (dB) = " << p.ebn0_step << std::endl;
+	std::cout << "#    ** Bench SNR (dB) = " << p.ebn0_bench<< std::endl;
+	std::cout << "#    ** Bench frames   = " << p.n_runs    << std::endl;
+	std::cout << "#"                                        << std::endl;
+}
+
+void init_modules(const params &p, modules &m)
+{
+	m.source  = std::unique_ptr<module::Source_random         <>>(new module::Source_random         <>(K        ));
+	m.encoder = std::unique_ptr<module::Encoder_repetition_sys<>>(new module::Encoder_repetition_sys<>(K, N     ));
+	m.modem   = std::unique_ptr<module::Modem_BPSK            <>>(new module::Modem_BPSK            <>(N        ));
+	m.channel = std::unique_ptr<module::Channel_AWGN_LLR      <>>(new module::Channel_AWGN_LLR      <>(N, p.seed));
+	m.decoder = std::unique_ptr<module::Decoder_repetition_std<>>(new module::Decoder_repetition_std<>(K, N     ));
+	m.monitor = std::unique_ptr<module::Monitor_BFER          <>>(new module::Monitor_BFER          <>(K, p.fe  ));
+	m.noise   = std::unique_ptr<tools::Sigma                  <>>(new tools::Sigma                  <>(         ));
+}
+
+void init_buffers(buffers &b)
+{
+	b.ref_bits      = std::vector<int  >(K);
+	b.enc_bits      = std::vector<int  >(N);
+	b.symbols       = std::vector<float>(N);
+	b.noisy_symbols = std::vector<float>(N);
+	b.LLRs          = std::vector<float>(N);
+	b.dec_bits      = std::vector<int  >(K);
+}
+
+void set_sigma(const float ebn0, const params &p, modules &m, modules_static &s)
+{
+	// compute the current sigma for the channel noise
+	const auto esn0  = tools::ebn0_to_esn0 (ebn0, p.R);
+	const auto sigma = tools::esn0_to_sigma(esn0     );
+
+	m.noise->set_noise(sigma, ebn0, esn0);
+	m.modem  ->set_noise(*m.noise);
+	m.channel->set_noise(*m.noise);
+	s.modem  . set_sigma(sigma);
+	s.channel. set_sigma(sigma);
+}
+
+// the compiler cannot remove the computations of a buffer that escapes
+inline void escape(const void *ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(ptr) : "memory");
+#else
+	static const void * volatile sink;
+	sink = ptr;
+#endif
+}
+
+// time 'n_runs' calls of 'stage' (in ns per frame)
+double time_stage(const uint64_t n_runs, const void *out, const std::function<void()> &stage)
+{
+	const auto t_start = std::chrono::steady_clock::now();
+	for (uint64_t r = 0; r < n_runs; r++)
+	{
+		stage();
+		escape(out);
+	}
+	const auto t_stop = std::chrono::steady_clock::now();
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() / (double)n_runs;
+}
+
+void benchmark(const params &p, modules &m, buffers &b, modules_static &s, buffers_static &bs)
+{
+	set_sigma(p.ebn0_bench, p, m, s);
+
+	struct stage { std::string name; double t_run; double t_sta; };
+	std::vector<stage> stages;
+
+	// each stage runs alone on the output of the previous one, the runtime modules execute their tasks (with the checks
+	// and the copies of the sockets)
+	stages.push_back({"source::generate",
+		time_stage(p.n_runs, b .ref_bits.data(), [&]() { m.source ->generate(b .ref_bits); }),
+		time_stage(p.n_runs, bs.ref_bits.data(), [&]() { s.source . generate(bs.ref_bits); })});
+	stages.push_back({"encoder::encode",
+		time_stage(p.n_runs, b .enc_bits.data(), [&]() { m.encoder->encode(b .ref_bits, b .enc_bits); }),
+		time_stage(p.n_runs, bs.enc_bits.data(), [&]() { s.encoder. encode(bs.ref_bits, bs.enc_bits); })});
+	stages.push_back({"modem::modulate",
+		time_stage(p.n_runs, b .symbols.data(), [&]() { m.modem->modulate(b .enc_bits, b .symbols); }),
+		time_stage(p.n_runs, bs.symbols.data(), [&]() { s.modem. modulate(bs.enc_bits, bs.symbols); })});
+	stages.push_back({"channel::add_noise",
+		time_stage(p.n_runs, b .noisy_symbols.data(), [&]() { m.channel->add_noise(b .symbols, b .noisy_symbols); }),
+		time_stage(p.n_runs, bs.noisy_symbols.data(), [&]() { s.channel. add_noise(bs.symbols, bs.noisy_symbols); })});
+	stages.push_back({"modem::demodulate",
+		time_stage(p.n_runs, b .LLRs.data(), [&]() { m.modem->demodulate(b .noisy_symbols, b .LLRs); }),
+		time_stage(p.n_runs, bs.LLRs.data(), [&]() { s.modem. demodulate(bs.noisy_symbols, bs.LLRs); })});
+	stages.push_back({"decoder::decode_siho",
+		time_stage(p.n_runs, b .dec_bits.data(), [&]() { m.decoder->decode_siho(b .LLRs, b .dec_bits); }),
+		time_stage(p.n_runs, bs.dec_bits.data(), [&]() { s.decoder. decode_siho(bs.LLRs, bs.dec_bits); })});
+	stages.push_back({"monitor::check_errors",
+		time_stage(p.n_runs, b .dec_bits.data(), [&]() { m.monitor->check_errors(b .dec_bits, b .ref_bits); }),
+		time_stage(p.n_runs, bs.dec_bits.data(), [&]() { s.monitor. check_errors(bs.ref_bits, bs.dec_bits); })});
+
+	// the whole chain, the buffers stay in the cache
+	stages.push_back({"chain",
+		time_stage(p.n_runs, b.dec_bits.data(), [&]()
+		{
+			m.source ->generate    (                 b.ref_bits     );
+			m.encoder->encode      (b.ref_bits,      b.enc_bits     );
+			m.modem  ->modulate    (b.enc_bits,      b.symbols      );
+			m.channel->add_noise   (b.symbols,       b.noisy_symbols);
+			m.modem  ->demodulate  (b.noisy_symbols, b.LLRs         );
+			m.decoder->decode_siho (b.LLRs,          b.dec_bits     );
+			m.monitor->check_errors(b.dec_bits,      b.ref_bits     );
+		}),
+		time_stage(p.n_runs, bs.dec_bits.data(), [&]()
+		{
+			s.source .generate    (                  bs.ref_bits     );
+			s.encoder.encode      (bs.ref_bits,      bs.enc_bits     );
+			s.modem  .modulate    (bs.enc_bits,      bs.symbols      );
+			s.channel.add_noise   (bs.symbols,       bs.noisy_symbols);
+			s.modem  .demodulate  (bs.noisy_symbols, bs.LLRs         );
+			s.decoder.decode_siho (bs.LLRs,          bs.dec_bits     );
+			s.monitor.check_errors(bs.ref_bits,      bs.dec_bits     );
+		})});
+
+	std::cout << "# Benchmark (" << p.n_runs << " frames per stage, K = " << K << ", N = " << N << "):" << std::endl;
+	std::cout << "# ----------------------|-------------|--------------|---------" << std::endl;
+	std::cout << "#                 STAGE |     RUNTIME | COMPILE-TIME | SPEEDUP " << std::endl;
+	std::cout << "#                       | (ns/frame)  |  (ns/frame)  |         " << std::endl;
+	std::cout << "# ----------------------|-------------|--------------|---------" << std::endl;
+	for (auto &st : stages)
+		std::cout << "# " << std::setw(21) << st.name << " | "
+		          << std::setw(11) << std::fixed << std::setprecision(2) << st.t_run << " | "
+		          << std::setw(12) << st.t_sta << " | "
+		          << std::setw(7)  << (st.t_sta > 0. ? st.t_run / st.t_sta : 0.) << std::endl;
+	std::cout << "# ----------------------|-------------|--------------|---------" << std::endl;
+
+	const auto &chain = stages.back();
+	std::cout << "# Chain throughput: runtime = " << (double)K * 1e3 / chain.t_run << " Mb/s, compile-time = "
+	          << (double)K * 1e3 / chain.t_sta << " Mb/s" << std::endl;
+	std::cout.unsetf(std::ios::floatfield);
+	std::cout << "#" << std::endl;
+}
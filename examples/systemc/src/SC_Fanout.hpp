@@ -0,0 +1,49 @@
+#ifndef SC_FANOUT_HPP_
+#define SC_FANOUT_HPP_
+
+#include <systemc>
+#include <tlm>
+#include <tlm_utils/simple_target_socket.h>
+#include <tlm_utils/simple_initiator_socket.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+// N-way version of the 'tools::SC_Duplicator': the transactions received on 's_in' are forwarded to all the 's_out'
+// sockets (in order), each consumer copies the frames from the payload in its own input socket
+class SC_Fanout : public sc_core::sc_module
+{
+	SC_HAS_PROCESS(SC_Fanout);
+
+public:
+	tlm_utils::simple_target_socket<SC_Fanout>                        s_in;
+	sc_core::sc_vector<tlm_utils::simple_initiator_socket<SC_Fanout>> s_out;
+
+public:
+	explicit SC_Fanout(const size_t n_out = 2, sc_core::sc_module_name name = "SC_Fanout")
+	: sc_module(name), s_in("s_in"), s_out("s_out", n_out)
+	{
+		s_in.register_b_transport(this, &SC_Fanout::b_transport);
+	}
+
+	virtual ~SC_Fanout() = default;
+
+	size_t get_n_out() const
+	{
+		return s_out.size();
+	}
+
+private:
+	void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& t)
+	{
+		// like the 'SC_Duplicator', the frame is sent to all the outputs: the targets of the AFF3CT SystemC modules do
+		// not set the response status of the transactions
+		for (size_t i = 0; i < s_out.size(); i++)
+			s_out[i]->b_transport(trans, t);
+	}
+};
+}
+}
+
+#endif /* SC_FANOUT_HPP_ */
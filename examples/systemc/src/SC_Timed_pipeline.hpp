@@ -0,0 +1,157 @@
+#ifndef SC_TIMED_PIPELINE_HPP_
+#define SC_TIMED_PIPELINE_HPP_
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <string>
+
+#include <systemc>
+
+#include <aff3ct.hpp>
+
+namespace aff3ct
+{
+namespace tools
+{
+// a stage of the timed model: a SystemC thread that waits for a token on each of its input FIFOs, spends 'latency'
+// in simulated time (= the measured latency of the corresponding task) and writes the token in each output FIFO
+class SC_Timed_stage : public sc_core::sc_module
+{
+	SC_HAS_PROCESS(SC_Timed_stage);
+
+public:
+	std::vector<sc_core::sc_fifo<unsigned long long>*> in;
+	std::vector<sc_core::sc_fifo<unsigned long long>*> out;
+
+private:
+	const sc_core::sc_time latency;
+	sc_core::sc_time       busy;
+	unsigned long long     n_tokens;
+	unsigned long long     n_tokens_max; // number of tokens produced by a source / consumed by a sink
+
+public:
+	SC_Timed_stage(sc_core::sc_module_name name, const sc_core::sc_time &latency)
+	: sc_module(name), latency(latency), busy(sc_core::SC_ZERO_TIME), n_tokens(0), n_tokens_max(0)
+	{
+		SC_THREAD(run);
+	}
+
+	void                    set_n_tokens_max(const unsigned long long n) { this->n_tokens_max = n; }
+	const sc_core::sc_time& get_latency     (                          ) const { return this->latency;  }
+	const sc_core::sc_time& get_busy        (                          ) const { return this->busy;     }
+	unsigned long long      get_n_tokens    (                          ) const { return this->n_tokens; }
+
+private:
+	void run()
+	{
+		while (true)
+		{
+			// a stage without input is a source: it stops after 'n_tokens_max' tokens
+			if (this->in.empty() && this->n_tokens >= this->n_tokens_max)
+				return;
+
+			auto token = this->n_tokens;
+			for (auto f : this->in)
+				token = f->read();
+
+			sc_core::wait(this->latency);
+			this->busy += this->latency;
+
+			for (auto f : this->out)
+				f->write(token);
+
+			// a stage without output is a sink: the simulation ends when the last token is consumed
+			if (++this->n_tokens == this->n_tokens_max && this->out.empty())
+				sc_core::sc_stop();
+		}
+	}
+};
+
+// untimed tasks + measured latencies = timed SystemC model of the task graph: each task is a pipeline stage (a hardware
+// unit or a thread) connected to the other stages by FIFOs, the model predicts the steady state throughput of the
+// pipeline and its bottleneck without building it
+class SC_Timed_pipeline
+{
+private:
+	std::vector<std::unique_ptr<SC_Timed_stage>>                       stages;
+	std::vector<std::unique_ptr<sc_core::sc_fifo<unsigned long long>>> fifos;
+	std::vector<std::string>                                           names;
+
+public:
+	SC_Timed_pipeline() = default;
+
+	// add a stage that models the 'task' execution with its average latency (the stats of the task have to be enabled)
+	size_t add_stage(const module::Task &task, const std::string &name)
+	{
+		const auto latency_ns = (double)task.get_duration_avg().count();
+		if (task.get_n_calls() == 0)
+		{
+			std::stringstream message;
+			message << "The task has never been executed, its latency is unknown ('name' = " << name << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const auto module_name = sc_core::sc_gen_unique_name("SC_Timed_stage");
+		this->stages.push_back(std::unique_ptr<SC_Timed_stage>(
+			new SC_Timed_stage(module_name, sc_core::sc_time(latency_ns, sc_core::SC_NS))));
+		this->names.push_back(name);
+		return this->stages.size() - 1;
+	}
+
+	void connect(const size_t from, const size_t to, const int depth = 1)
+	{
+		this->fifos.push_back(std::unique_ptr<sc_core::sc_fifo<unsigned long long>>(
+			new sc_core::sc_fifo<unsigned long long>(sc_core::sc_gen_unique_name("fifo"), depth)));
+		this->stages[from]->out.push_back(this->fifos.back().get());
+		this->stages[to  ]->in .push_back(this->fifos.back().get());
+	}
+
+	// simulate 'n_tokens' tokens (= task executions) and display the predicted throughput and the bottleneck
+	void run(const unsigned long long n_tokens, const int n_frames, const int K, std::ostream &stream = std::cout)
+	{
+		for (auto &s : this->stages)
+			s->set_n_tokens_max(n_tokens);
+
+		sc_core::sc_start();
+
+		const auto t_sim = sc_core::sc_time_stamp().to_seconds();
+		const auto prec  = stream.precision();
+
+		size_t bottleneck = 0;
+		for (size_t s = 1; s < this->stages.size(); s++)
+			if (this->stages[s]->get_busy() > this->stages[bottleneck]->get_busy())
+				bottleneck = s;
+
+		stream << "# Throughput prediction (timed model, " << n_tokens << " executions of " << n_frames
+		       << " frame(s) per task):" << std::endl;
+		stream << "# ----------------------------------------|--------------|-----------" << std::endl;
+		stream << "#                                   STAGE |      LATENCY |     USAGE " << std::endl;
+		stream << "#                                         |         (us) |       (%) " << std::endl;
+		stream << "# ----------------------------------------|--------------|-----------" << std::endl;
+		for (size_t s = 0; s < this->stages.size(); s++)
+		{
+			const auto usage = t_sim > 0. ? 100. * this->stages[s]->get_busy().to_seconds() / t_sim : 0.;
+			stream << "# " << std::setw(39) << this->names[s] << " | "
+			       << std::setw(12) << std::fixed << std::setprecision(3)
+			       << this->stages[s]->get_latency().to_seconds() * 1e6 << " | "
+			       << std::setw(9)  << std::setprecision(2) << usage
+			       << (s == bottleneck ? " <" : "") << std::endl;
+		}
+		stream << "# ----------------------------------------|--------------|-----------" << std::endl;
+
+		const auto fps = t_sim > 0. ? (double)(n_tokens * n_frames) / t_sim : 0.;
+		stream << "# Predicted throughput = " << std::setprecision(2) << fps << " frames/s ("
+		       << fps * K * 1e-6 << " Mb/s)" << std::endl;
+		stream << "# Bottleneck stage     = " << this->names[bottleneck] << std::endl;
+		stream.unsetf(std::ios::floatfield);
+		stream.precision(prec);
+	}
+};
+}
+}
+
+#endif /* SC_TIMED_PIPELINE_HPP_ */
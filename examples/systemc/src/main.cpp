@@ -8,16 +8,25 @@
 #include <aff3ct.hpp>
 using namespace aff3ct;
 
+#include "SC_Fanout.hpp"
+#include "SC_Timed_pipeline.hpp"
+
 struct params
 {
 	int   K         =  32;     // number of information bits
 	int   N         = 128;     // codeword size
 	int   fe        = 100;     // number of frame errors
 	int   seed      =   0;     // PRNG seed for the AWGN channel
+	int   n_frames  =  16;     // number of frames per TLM transaction (batch size)
 	float ebn0_min  =   0.00f; // minimum SNR value
 	float ebn0_max  =  10.01f; // maximum SNR value
 	float ebn0_step =   1.00f; // SNR step
 	float R;                   // code rate (R=K/N)
+
+	bool  predict   = false;   // predict the pipeline throughput from the measured task latencies (no BER/FER)
+	int   n_calib   = 1000;    // number of executions of the chain to measure the latencies of the tasks
+	int   n_predict = 100000;  // number of executions of each task simulated by the timed model
+	int   fifo      = 1;       // depth of the FIFOs between the stages of the timed model
 };
 void init_params(params &p);
 
@@ -29,9 +38,11 @@ struct modules
 	std::unique_ptr<module::Channel_AWGN_LLR<>>       channel;
 	std::unique_ptr<module::Decoder_repetition_std<>> decoder;
 	std::unique_ptr<module::Monitor_BFER<>>           monitor;
+	std::unique_ptr<tools::SC_Fanout>                 fanout; // send the source 'generate' task output to its consumers
 	std::vector<const module::Module*>                list; // list of module pointers declared in this structure
 };
 void init_modules(const params &p, modules &m);
+void init_sc_graph(modules &m); // create the SystemC modules and bind their sockets (only once)
 
 struct utils
 {
@@ -40,6 +51,7 @@ struct utils
 	std::unique_ptr<tools::Terminal_std>          terminal;  // manage the output text in the terminal
 };
 void init_utils(const modules &m, utils &u);
+void predict_throughput(const params &p, modules &m, utils &u); // calibration run + timed SystemC model
 
 int sc_main(int argc, char** argv)
 {
@@ -58,16 +70,27 @@ int sc_main(int argc, char** argv)
 	modules m; init_modules(p, m); // create and initialize the modules
 	utils   u; init_utils  (m, u); // create and initialize the utils
 
+	if (p.predict)
+	{
+		predict_throughput(p, m, u);
+		return 0;
+	}
+
 	// display the legend in the terminal
 	u.terminal->legend();
 
-	// add a callback to the monitor to call the "sc_core::sc_stop()" function
+	// add a callback to the monitor to pause the SystemC simulation at the end of an SNR point, the simulation context
+	// and the SystemC graph are kept and the simulation is resumed by the next "sc_core::sc_start()" call
 	m.monitor->add_handler_check([&m, &u]() -> void
 	{
 		if (m.monitor->fe_limit_achieved() || u.terminal->is_interrupt())
-			sc_core::sc_stop();
+			sc_core::sc_pause();
 	});
 
+	// the SystemC graph is built once and reused for all the SNR points
+	init_sc_graph(m);
+	sc_core::sc_report_handler::set_actions(sc_core::SC_INFO, sc_core::SC_DO_NOTHING);
+
 	// a loop over the various SNRs
 	for (auto ebn0 = p.ebn0_min; ebn0 < p.ebn0_max; ebn0 += p.ebn0_step)
 	{
@@ -81,34 +104,10 @@ int sc_main(int argc, char** argv)
 		m.modem  ->set_noise(*u.noise);
 		m.channel->set_noise(*u.noise);
 
-		// create "sc_core::sc_module" instances for each task
-		using namespace module;
-		m.source ->sc.create_module(+src::tsk::generate    );
-		m.encoder->sc.create_module(+enc::tsk::encode      );
-		m.modem  ->sc.create_module(+mdm::tsk::modulate    );
-		m.modem  ->sc.create_module(+mdm::tsk::demodulate  );
-		m.channel->sc.create_module(+chn::tsk::add_noise   );
-		m.decoder->sc.create_module(+dec::tsk::decode_siho );
-		m.monitor->sc.create_module(+mnt::tsk::check_errors);
-
-		// declare a SystemC duplicator to duplicate the source 'generate' task output
-		tools::SC_Duplicator duplicator;
-
-		// bind the sockets between the modules
-		m.source ->sc[+src::tsk::generate   ].s_out[+src::sck::generate   ::U_K ](duplicator                            .s_in                               );
-		duplicator                           .s_out1                             (m.monitor->sc[+mnt::tsk::check_errors].s_in[+mnt::sck::check_errors::U   ]);
-		duplicator                           .s_out2                             (m.encoder->sc[+enc::tsk::encode      ].s_in[+enc::sck::encode      ::U_K ]);
-		m.encoder->sc[+enc::tsk::encode     ].s_out[+enc::sck::encode     ::X_N ](m.modem  ->sc[+mdm::tsk::modulate    ].s_in[+mdm::sck::modulate    ::X_N1]);
-		m.modem  ->sc[+mdm::tsk::modulate   ].s_out[+mdm::sck::modulate   ::X_N2](m.channel->sc[+chn::tsk::add_noise   ].s_in[+chn::sck::add_noise   ::X_N ]);
-		m.channel->sc[+chn::tsk::add_noise  ].s_out[+chn::sck::add_noise  ::Y_N ](m.modem  ->sc[+mdm::tsk::demodulate  ].s_in[+mdm::sck::demodulate  ::Y_N1]);
-		m.modem  ->sc[+mdm::tsk::demodulate ].s_out[+mdm::sck::demodulate ::Y_N2](m.decoder->sc[+dec::tsk::decode_siho ].s_in[+dec::sck::decode_siho ::Y_N ]);
-		m.decoder->sc[+dec::tsk::decode_siho].s_out[+dec::sck::decode_siho::V_K ](m.monitor->sc[+mnt::tsk::check_errors].s_in[+mnt::sck::check_errors::V   ]);
-
 		// display the performance (BER and FER) in real time (in a separate thread)
 		u.terminal->start_temp_report();
 
-		// start the SystemC simulation
-		sc_core::sc_report_handler::set_actions(sc_core::SC_INFO, sc_core::SC_DO_NOTHING);
+		// start (or resume) the SystemC simulation
 		sc_core::sc_start();
 
 		// display the performance (BER and FER) in the terminal
@@ -120,12 +119,11 @@ int sc_main(int argc, char** argv)
 
 		// if user pressed Ctrl+c twice, exit the SNRs loop
 		if (u.terminal->is_over()) break;
-
-		// dirty way to create a new SystemC simulation context
-		sc_core::sc_curr_simcontext = new sc_core::sc_simcontext();
-		sc_core::sc_default_global_context = sc_core::sc_curr_simcontext;
 	}
 
+	// end the paused SystemC simulation
+	sc_core::sc_stop();
+
 	// display the statistics of the tasks (if enabled)
 	std::cout << "#" << std::endl;
 	tools::Stats::show(m.list, true);
@@ -143,20 +141,29 @@ void init_params(params &p)
 	std::cout << "#    ** Info. bits (K) = " << p.K         << std::endl;
 	std::cout << "#    ** Frame size (N) = " << p.N         << std::endl;
 	std::cout << "#    ** Code rate  (R) = " << p.R         << std::endl;
+	std::cout << "#    ** Frames / TLM   = " << p.n_frames  << std::endl;
 	std::cout << "#    ** SNR min   (dB) = " << p.ebn0_min  << std::endl;
 	std::cout << "#    ** SNR max   (dB) = " << p.ebn0_max  << std::endl;
 	std::cout << "#    ** SNR step  (dB) = " << p.ebn0_step << std::endl;
+	if (p.predict)
+	{
+		std::cout << "#    ** Calib. runs    = " << p.n_calib   << std::endl;
+		std::cout << "#    ** Timed runs     = " << p.n_predict << std::endl;
+		std::cout << "#    ** FIFOs depth    = " << p.fifo      << std::endl;
+	}
 	std::cout << "#"                                        << std::endl;
 }
 
 void init_modules(const params &p, modules &m)
 {
-	m.source  = std::unique_ptr<module::Source_random         <>>(new module::Source_random         <>(p.K        ));
-	m.encoder = std::unique_ptr<module::Encoder_repetition_sys<>>(new module::Encoder_repetition_sys<>(p.K, p.N   ));
-	m.modem   = std::unique_ptr<module::Modem_BPSK            <>>(new module::Modem_BPSK            <>(p.N        ));
-	m.channel = std::unique_ptr<module::Channel_AWGN_LLR      <>>(new module::Channel_AWGN_LLR      <>(p.N, p.seed));
-	m.decoder = std::unique_ptr<module::Decoder_repetition_std<>>(new module::Decoder_repetition_std<>(p.K, p.N   ));
-	m.monitor = std::unique_ptr<module::Monitor_BFER          <>>(new module::Monitor_BFER          <>(p.K, p.fe  ));
+	// all the modules process 'n_frames' frames per task execution, then each TLM transaction between the SystemC
+	// modules carries a batch of 'n_frames' frames instead of a single frame
+	m.source  = std::unique_ptr<module::Source_random         <>>(new module::Source_random         <>(p.K, 0,                                 p.n_frames));
+	m.encoder = std::unique_ptr<module::Encoder_repetition_sys<>>(new module::Encoder_repetition_sys<>(p.K, p.N,    true,                      p.n_frames));
+	m.modem   = std::unique_ptr<module::Modem_BPSK            <>>(new module::Modem_BPSK            <>(p.N, tools::Sigma<>(), false,           p.n_frames));
+	m.channel = std::unique_ptr<module::Channel_AWGN_LLR      <>>(new module::Channel_AWGN_LLR      <>(p.N, p.seed, false, tools::Sigma<>(), p.n_frames));
+	m.decoder = std::unique_ptr<module::Decoder_repetition_std<>>(new module::Decoder_repetition_std<>(p.K, p.N,    true,                      p.n_frames));
+	m.monitor = std::unique_ptr<module::Monitor_BFER          <>>(new module::Monitor_BFER          <>(p.K, p.fe,   0, false,                  p.n_frames));
 
 	m.list = { m.source.get(), m.encoder.get(), m.modem.get(), m.channel.get(), m.decoder.get(), m.monitor.get() };
 
@@ -176,6 +183,33 @@ void init_modules(const params &p, modules &m)
 		}
 }
 
+void init_sc_graph(modules &m)
+{
+	// create "sc_core::sc_module" instances for each task
+	using namespace module;
+	m.source ->sc.create_module(+src::tsk::generate    );
+	m.encoder->sc.create_module(+enc::tsk::encode      );
+	m.modem  ->sc.create_module(+mdm::tsk::modulate    );
+	m.modem  ->sc.create_module(+mdm::tsk::demodulate  );
+	m.channel->sc.create_module(+chn::tsk::add_noise   );
+	m.decoder->sc.create_module(+dec::tsk::decode_siho );
+	m.monitor->sc.create_module(+mnt::tsk::check_errors);
+
+	// declare a SystemC fan-out to share the source 'generate' task output between the monitor and the encoder
+	m.fanout = std::unique_ptr<tools::SC_Fanout>(new tools::SC_Fanout(2));
+	auto &fanout = *m.fanout;
+
+	// bind the sockets between the modules
+	m.source ->sc[+src::tsk::generate   ].s_out[+src::sck::generate   ::U_K ](fanout                                .s_in                               );
+	fanout                               .s_out[0]                           (m.monitor->sc[+mnt::tsk::check_errors].s_in[+mnt::sck::check_errors::U   ]);
+	fanout                               .s_out[1]                           (m.encoder->sc[+enc::tsk::encode      ].s_in[+enc::sck::encode      ::U_K ]);
+	m.encoder->sc[+enc::tsk::encode     ].s_out[+enc::sck::encode     ::X_N ](m.modem  ->sc[+mdm::tsk::modulate    ].s_in[+mdm::sck::modulate    ::X_N1]);
+	m.modem  ->sc[+mdm::tsk::modulate   ].s_out[+mdm::sck::modulate   ::X_N2](m.channel->sc[+chn::tsk::add_noise   ].s_in[+chn::sck::add_noise   ::X_N ]);
+	m.channel->sc[+chn::tsk::add_noise  ].s_out[+chn::sck::add_noise  ::Y_N ](m.modem  ->sc[+mdm::tsk::demodulate  ].s_in[+mdm::sck::demodulate  ::Y_N1]);
+	m.modem  ->sc[+mdm::tsk::demodulate ].s_out[+mdm::sck::demodulate ::Y_N2](m.decoder->sc[+dec::tsk::decode_siho ].s_in[+dec::sck::decode_siho ::Y_N ]);
+	m.decoder->sc[+dec::tsk::decode_siho].s_out[+dec::sck::decode_siho::V_K ](m.monitor->sc[+mnt::tsk::check_errors].s_in[+mnt::sck::check_errors::V   ]);
+}
+
 void init_utils(const modules &m, utils &u)
 {
 	// create a sigma noise type
@@ -188,4 +222,66 @@ void init_utils(const modules &m, utils &u)
 	u.reporters.push_back(std::unique_ptr<tools::Reporter>(new tools::Reporter_throughput<>(*m.monitor)));
 	// create a terminal that will display the collected data from the reporters
 	u.terminal = std::unique_ptr<tools::Terminal_std>(new tools::Terminal_std(u.reporters));
+}
+
+void predict_throughput(const params &p, modules &m, utils &u)
+{
+	// calibration run: execute the untimed task chain at the first SNR to measure the average latency of each task
+	using namespace module;
+	(*m.encoder)[enc::sck::encode      ::U_K ].bind((*m.source )[src::sck::generate   ::U_K ]);
+	(*m.modem  )[mdm::sck::modulate    ::X_N1].bind((*m.encoder)[enc::sck::encode     ::X_N ]);
+	(*m.channel)[chn::sck::add_noise   ::X_N ].bind((*m.modem  )[mdm::sck::modulate   ::X_N2]);
+	(*m.modem  )[mdm::sck::demodulate  ::Y_N1].bind((*m.channel)[chn::sck::add_noise  ::Y_N ]);
+	(*m.decoder)[dec::sck::decode_siho ::Y_N ].bind((*m.modem  )[mdm::sck::demodulate ::Y_N2]);
+	(*m.monitor)[mnt::sck::check_errors::U   ].bind((*m.encoder)[enc::sck::encode     ::U_K ]);
+	(*m.monitor)[mnt::sck::check_errors::V   ].bind((*m.decoder)[dec::sck::decode_siho::V_K ]);
+
+	const auto esn0  = tools::ebn0_to_esn0 (p.ebn0_min, p.R);
+	const auto sigma = tools::esn0_to_sigma(esn0           );
+	u.noise->set_noise(sigma, p.ebn0_min, esn0);
+	m.modem  ->set_noise(*u.noise);
+	m.channel->set_noise(*u.noise);
+
+	for (auto c = 0; c < p.n_calib; c++)
+	{
+		(*m.source )[src::tsk::generate    ].exec();
+		(*m.encoder)[enc::tsk::encode      ].exec();
+		(*m.modem  )[mdm::tsk::modulate    ].exec();
+		(*m.channel)[chn::tsk::add_noise   ].exec();
+		(*m.modem  )[mdm::tsk::demodulate  ].exec();
+		(*m.decoder)[dec::tsk::decode_siho ].exec();
+		(*m.monitor)[mnt::tsk::check_errors].exec();
+	}
+
+	// timed model: each task becomes a pipeline stage that waits for its measured latency
+	auto name = [](const module::Module &mod, const module::Task &tsk) -> std::string
+	{
+		return mod.get_short_name() + "::" + tsk.get_name();
+	};
+
+	tools::SC_Timed_pipeline pipeline;
+	const auto s_gen = pipeline.add_stage((*m.source )[src::tsk::generate    ], name(*m.source,  (*m.source )[src::tsk::generate    ]));
+	const auto s_enc = pipeline.add_stage((*m.encoder)[enc::tsk::encode      ], name(*m.encoder, (*m.encoder)[enc::tsk::encode      ]));
+	const auto s_mod = pipeline.add_stage((*m.modem  )[mdm::tsk::modulate    ], name(*m.modem,   (*m.modem  )[mdm::tsk::modulate    ]));
+	const auto s_chn = pipeline.add_stage((*m.channel)[chn::tsk::add_noise   ], name(*m.channel, (*m.channel)[chn::tsk::add_noise   ]));
+	const auto s_dmd = pipeline.add_stage((*m.modem  )[mdm::tsk::demodulate  ], name(*m.modem,   (*m.modem  )[mdm::tsk::demodulate  ]));
+	const auto s_dec = pipeline.add_stage((*m.decoder)[dec::tsk::decode_siho ], name(*m.decoder, (*m.decoder)[dec::tsk::decode_siho ]));
+	const auto s_chk = pipeline.add_stage((*m.monitor)[mnt::tsk::check_errors], name(*m.monitor, (*m.monitor)[mnt::tsk::check_errors]));
+
+	pipeline.connect(s_gen, s_enc, p.fifo);
+	pipeline.connect(s_enc, s_mod, p.fifo);
+	pipeline.connect(s_mod, s_chn, p.fifo);
+	pipeline.connect(s_chn, s_dmd, p.fifo);
+	pipeline.connect(s_dmd, s_dec, p.fifo);
+	pipeline.connect(s_dec, s_chk, p.fifo);
+	// the 'U' path bypasses the 5 stages of the other path, its FIFO can hold all the frames in flight in these stages
+	pipeline.connect(s_gen, s_chk, 6 * (p.fifo + 1));
+
+	sc_core::sc_report_handler::set_actions(sc_core::SC_INFO, sc_core::SC_DO_NOTHING);
+	pipeline.run((unsigned long long)p.n_predict, p.n_frames, p.K);
+
+	// display the measured statistics of the tasks (calibration run)
+	std::cout << "#" << std::endl;
+	tools::Stats::show(m.list, true);
+	std::cout << "# End of the simulation" << std::endl;
 }
\ No newline at end of file